@@ -0,0 +1,139 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include <stddef.h>
+
+/* status codes */
+#define DQ_OK   0   // operation successful
+#define DQ_ERR -1   // operation failed
+
+/**
+ * opaque double-ended queue type
+ * elements are stored in fixed-size blocks indexed through a circular block map,
+ * so growing at either end never relocates existing elements
+ */
+typedef struct Deque Deque;
+
+/* constructor / destructor */
+
+/**
+ * creates a new deque with elements of size `elem_size`
+ *
+ * @param elem_size size of each element in bytes
+ * @return pointer to the newly created deque, or NULL on failure
+ */
+Deque *dq_create(size_t elem_size);
+
+/**
+ * frees all memory used by the deque
+ *
+ * @param dq pointer to the deque to destroy
+ */
+void dq_destroy(Deque *dq);
+
+
+/* insertion */
+
+/**
+ * inserts an element at the front of the deque in amortized constant time O(1)
+ *
+ * @param dq pointer to the deque
+ * @param src pointer to the element to insert
+ * @return DQ_OK on success, DQ_ERR on failure
+ */
+int dq_push_front(Deque *dq, const void *src);
+
+/**
+ * inserts an element at the back of the deque in amortized constant time O(1)
+ *
+ * @param dq pointer to the deque
+ * @param src pointer to the element to insert
+ * @return DQ_OK on success, DQ_ERR on failure
+ */
+int dq_push_back(Deque *dq, const void *src);
+
+
+/* deletion */
+
+/**
+ * removes the front element in constant time O(1)
+ *
+ * @param dq pointer to the deque
+ * @return DQ_OK on success, DQ_ERR if the deque is empty or invalid
+ */
+int dq_pop_front(Deque *dq);
+
+/**
+ * removes the back element in constant time O(1)
+ *
+ * @param dq pointer to the deque
+ * @return DQ_OK on success, DQ_ERR if the deque is empty or invalid
+ */
+int dq_pop_back(Deque *dq);
+
+
+/* access */
+
+/**
+ * returns a pointer to the front element
+ *
+ * @param dq pointer to the deque
+ * @return pointer to the front element, or NULL if the deque is empty
+ */
+void *dq_front(const Deque *dq);
+
+/**
+ * returns a pointer to the back element
+ *
+ * @param dq pointer to the deque
+ * @return pointer to the back element, or NULL if the deque is empty
+ */
+void *dq_back(const Deque *dq);
+
+/**
+ * returns a pointer to the element at the given index in constant time O(1)
+ *
+ * @param dq pointer to the deque
+ * @param index position of the element to retrieve (0-indexed)
+ * @return pointer to the element, or NULL if out of bounds
+ * @note returned pointer stays valid until that element is removed
+ */
+void *dq_get(const Deque *dq, size_t index);
+
+/**
+ * overwrites the element at the given index by copying from src
+ *
+ * @param dq pointer to the deque
+ * @param index position of the element to modify (0-indexed)
+ * @param src pointer to the source data to copy
+ * @return DQ_OK on success, DQ_ERR on failure
+ */
+int dq_set(Deque *dq, size_t index, const void *src);
+
+
+/* utilities */
+
+/**
+ * returns the number of elements in the deque
+ *
+ * @param dq pointer to the deque
+ * @return number of elements
+ */
+size_t dq_size(const Deque *dq);
+
+/**
+ * checks if the deque is empty
+ *
+ * @param dq pointer to the deque
+ * @return non-zero if empty, 0 otherwise
+ */
+int dq_is_empty(const Deque *dq);
+
+/**
+ * clears the deque contents (size becomes 0)
+ *
+ * @param dq pointer to the deque
+ */
+void dq_clear(Deque *dq);
+
+#endif // DEQUE_H
@@ -6,10 +6,28 @@
 /* status codes */
 #define DL_OK   0   // operation successful
 #define DL_ERR -1   // operation failed
+#define DL_PENDING 1   // compaction in progress, call again
 
 /* opaque doubly linked list type */
 typedef struct DoublyList DoublyList;
 
+/**
+ * comparison function used to order elements
+ * returns negative if a < b, 0 if equal, positive if a > b
+ */
+typedef int (*dl_cmp_fn)(const void *a, const void *b);
+
+/**
+ * cursor: a position inside a list, used to walk and edit it in O(1) per step
+ * besides elements, a cursor can sit on one of two end positions:
+ * before the first element or after the last one
+ * a cursor stays valid until the element it sits on is removed by another call
+ */
+typedef struct DLCursor {
+    DoublyList *list;       // list the cursor walks
+    struct DLNode *node;    // current position (private, don't touch)
+} DLCursor;
+
 /* constructor / destructor */
 
 /**
@@ -20,6 +38,17 @@ typedef struct DoublyList DoublyList;
  */
 DoublyList *dl_create(size_t elem_size);
 
+/**
+ * creates a new doubly linked list holding a copy of `count` elements of
+ * `src`, in order, with all the nodes carved from one contiguous block
+ *
+ * @param elem_size size of each element in bytes
+ * @param src pointer to the first element of the array (may be NULL if `count` is 0)
+ * @param count number of elements in the array
+ * @return pointer to the newly created list, or NULL on failure
+ */
+DoublyList *dl_from_array(size_t elem_size, const void *src, size_t count);
+
 /**
  * frees all memory used by the list
  *
@@ -107,12 +136,16 @@ void *dl_back(const DoublyList *list);
 
 /**
  * returns a pointer to the element at the given index (0-indexed)
+ * the walk starts from the closest of both ends and the last index reached,
+ * so getting consecutive indices is O(1) each
  *
  * @param list pointer to the doubly list
  * @param index position of the element to retrieve
  * @return pointer to the element, or NULL if out of bounds
+ * @note remembering the last index reached writes to the list: concurrent
+ *       calls on one list need the same locking as modifiers
  */
-void *dl_get(const DoublyList *list, size_t index);
+void *dl_get(DoublyList *list, size_t index);
 
 
 /* utilities */
@@ -133,6 +166,16 @@ size_t dl_size(const DoublyList *list);
  */
 int dl_is_empty(const DoublyList *list);
 
+/**
+ * copies the elements, in order, into the array `dst` in one walk
+ *
+ * @param list pointer to the doubly list
+ * @param dst array receiving the elements
+ * @param capacity number of elements `dst` can hold
+ * @return number of elements copied (at most `capacity`)
+ */
+size_t dl_to_array(const DoublyList *list, void *dst, size_t capacity);
+
 /**
  * clears the list contents (size becomes 0)
  *
@@ -140,4 +183,156 @@ int dl_is_empty(const DoublyList *list);
  */
 void dl_clear(DoublyList *list);
 
+
+/* cursor */
+
+/**
+ * returns a cursor on the first element (on the end position if the list is empty)
+ *
+ * @param list pointer to the doubly list
+ * @return the cursor (its list is NULL if `list` is invalid)
+ */
+DLCursor dl_cursor_begin(DoublyList *list);
+
+/**
+ * returns a cursor on the last element (on the end position if the list is empty)
+ *
+ * @param list pointer to the doubly list
+ * @return the cursor (its list is NULL if `list` is invalid)
+ */
+DLCursor dl_cursor_last(DoublyList *list);
+
+/**
+ * checks whether the cursor sits on an end position (no element under it)
+ *
+ * @param cur pointer to the cursor
+ * @return non-zero if on an end position or invalid, 0 otherwise
+ */
+int dl_cursor_is_end(const DLCursor *cur);
+
+/**
+ * moves the cursor to the next element (or past the last one) in constant time O(1)
+ *
+ * @param cur pointer to the cursor
+ * @return DL_OK on success, DL_ERR if already past the last element
+ */
+int dl_cursor_next(DLCursor *cur);
+
+/**
+ * moves the cursor to the previous element (or before the first one) in constant time O(1)
+ *
+ * @param cur pointer to the cursor
+ * @return DL_OK on success, DL_ERR if already before the first element
+ */
+int dl_cursor_prev(DLCursor *cur);
+
+/**
+ * returns a pointer to the element under the cursor
+ *
+ * @param cur pointer to the cursor
+ * @return pointer to the element, or NULL on an end position
+ */
+void *dl_cursor_get(const DLCursor *cur);
+
+/**
+ * inserts an element right before the cursor in constant time O(1)
+ * the cursor keeps sitting on the same element (past the end: appends)
+ *
+ * @param cur pointer to the cursor
+ * @param src pointer to the element to insert
+ * @return DL_OK on success, DL_ERR on failure (or before the first element)
+ */
+int dl_cursor_insert_before(DLCursor *cur, const void *src);
+
+/**
+ * inserts an element right after the cursor in constant time O(1)
+ * the cursor keeps sitting on the same element (before the first: prepends)
+ *
+ * @param cur pointer to the cursor
+ * @param src pointer to the element to insert
+ * @return DL_OK on success, DL_ERR on failure (or past the last element)
+ */
+int dl_cursor_insert_after(DLCursor *cur, const void *src);
+
+/**
+ * removes the element under the cursor in constant time O(1)
+ * the cursor moves to the following element (or past the last one)
+ *
+ * @param cur pointer to the cursor
+ * @return DL_OK on success, DL_ERR on failure (or on an end position)
+ */
+int dl_cursor_erase(DLCursor *cur);
+
+
+/* sort / merge / splice */
+/* nodes are relinked without allocation or element copy */
+
+/**
+ * sorts the list in place with a stable bottom-up merge sort, O(n log n)
+ * cursors keep sitting on the same elements
+ *
+ * @param list pointer to the doubly list
+ * @param cmp comparison function
+ * @return DL_OK on success, DL_ERR on failure
+ */
+int dl_sort(DoublyList *list, dl_cmp_fn cmp);
+
+/**
+ * merges the sorted list `src` into the sorted list `dst` in linear time O(n + m)
+ * the merge is stable (on ties, the elements of `dst` come first) and `src` ends up empty
+ *
+ * @param dst pointer to the list receiving the elements
+ * @param src pointer to the list giving its elements (same element size)
+ * @param cmp comparison function both lists are sorted by
+ * @return DL_OK on success, DL_ERR on failure
+ * @note cursors on elements of `src` become invalid
+ * @note lists exchanging nodes end up sharing their node pool (joined in O(1))
+ */
+int dl_merge(DoublyList *dst, DoublyList *src, dl_cmp_fn cmp);
+
+/**
+ * moves the elements [first, last) right before `pos`, within a list or from another one
+ * between two lists it is O(1), within a list the range is walked once (O(count)) to
+ * make sure `pos` is not inside (first, last)
+ * afterwards `first` sits on the first moved element, in the list of `pos`
+ *
+ * @param pos cursor on the insertion point (may be past the last element)
+ * @param first cursor on the first element to move
+ * @param last cursor on the element after the range (same list as `first`)
+ * @param count number of elements in [first, last), ignored within a list
+ * @return DL_OK on success, DL_ERR on failure (`pos` inside (first, last), `last`
+ *         before `first`, or a count that is zero, too large or inconsistent with
+ *         a whole-list range)
+ * @note between two lists, `count` is trusted beyond those checks: a wrong count
+ *       leaves both sizes wrong
+ * @note lists exchanging nodes end up sharing their node pool (joined in O(1))
+ */
+int dl_splice(DLCursor *pos, DLCursor *first, DLCursor *last, size_t count);
+
+
+
+/* compaction */
+
+/**
+ * moves every node, in traversal order, into one contiguous slab so that a
+ * full walk touches memory sequentially again (finishes a compaction in progress)
+ *
+ * @param list pointer to the doubly list
+ * @return DL_OK on success, DL_ERR on failure
+ * @note pointers to elements and cursors become invalid
+ */
+int dl_compact(DoublyList *list);
+
+/**
+ * same as `dl_compact`, but visits at most `max_nodes` nodes per call
+ * the list can be used and modified between two steps
+ *
+ * @param list pointer to the doubly list
+ * @param max_nodes upper bound of nodes visited by this call
+ * @return DL_OK once compacted, DL_PENDING if more steps are needed, DL_ERR on failure
+ * @note pointers to elements and cursors on visited nodes become invalid;
+ *       sort restarts the walk, clear / merge / splice stop the compaction
+ */
+int dl_compact_step(DoublyList *list, size_t max_nodes);
+
 #endif // DOUBLY_LIST_H
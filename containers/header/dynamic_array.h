@@ -37,6 +37,16 @@ void da_destroy(DynamicArray *arr);
  */
 void *da_get(const DynamicArray *arr, size_t index);
 
+/**
+ * returns a pointer to the raw buffer, element i is at byte i * elem_size
+ * meant for hot loops that would otherwise call da_get per element
+ *
+ * @param arr pointer to the dynamic array
+ * @return pointer to the first element, or NULL if the array is invalid
+ * @note the pointer is invalidated when an insertion grows the buffer
+ */
+void *da_data(const DynamicArray *arr);
+
 /**
  * returns a pointer to the last element in the array
  *
@@ -64,6 +74,17 @@ int da_set(DynamicArray *arr, size_t index, const void *src);
  */
 int da_push_back(DynamicArray *arr, const void *src);
 
+/**
+ * appends `count` elements to the end of the array with one copy
+ * (the buffer is reallocated at most once)
+ *
+ * @param arr pointer to the dynamic array
+ * @param src pointer to the first element to append (may be NULL if `count` is 0)
+ * @param count number of elements to append
+ * @return DA_OK on success, DA_ERR on failure (the array is left unchanged)
+ */
+int da_append(DynamicArray *arr, const void *src, size_t count);
+
 /**
  * inserts an element at a specific index, shifting elements as needed
  *
@@ -0,0 +1,93 @@
+#ifndef EPOCH_RECLAIM_H
+#define EPOCH_RECLAIM_H
+
+#include <stddef.h>
+
+/* status codes */
+#define EBR_OK   0   // operation successful
+#define EBR_ERR -1   // operation failed
+
+/**
+ * opaque epoch-based reclamation domain
+ * lock-free structures can't free a node they unlink right away: another
+ * thread may still be reading it. threads access the shared structure inside
+ * a critical section (ebr_enter / ebr_exit) and hand the unlinked nodes to
+ * ebr_retire, a retired node is freed once every critical section that could
+ * have seen it has ended (the global epoch moved twice)
+ *
+ * critical sections don't need any thread registration: each one borrows a
+ * per-domain record, records are created on demand and reused
+ */
+typedef struct EpochDomain EpochDomain;
+
+/* a critical section in progress (private, don't touch) */
+typedef struct EpochRecord EpochGuard;
+
+/**
+ * link embedded in every object that can be retired (intrusive, so retiring
+ * never allocates), the object is recovered with EBR_ENTRY
+ */
+typedef struct EBRLink {
+    struct EBRLink *next;                   // private, don't touch
+    void (*free_fn)(struct EBRLink *link);  // private, don't touch
+} EBRLink;
+
+/**
+ * returns a pointer to the object containing `link`
+ *
+ * @param link pointer to the embedded EBRLink
+ * @param type type of the containing object
+ * @param member name of the EBRLink member inside `type`
+ */
+#define EBR_ENTRY(link, type, member) \
+    ((type *)((char *)(link) - offsetof(type, member)))
+
+/* constructor / destructor */
+
+/**
+ * creates a new reclamation domain
+ *
+ * @return pointer to the newly created domain, or NULL on failure
+ */
+EpochDomain *ebr_create(void);
+
+/**
+ * frees every object still waiting for reclamation, then the domain
+ * no thread may be inside a critical section anymore
+ *
+ * @param domain pointer to the domain to destroy
+ */
+void ebr_destroy(EpochDomain *domain);
+
+
+/* critical sections */
+
+/**
+ * starts a critical section: nodes reachable from now on stay allocated
+ * until the matching ebr_exit, sections may nest (each one is independent)
+ *
+ * @param domain pointer to the domain
+ * @return the guard to pass to ebr_retire / ebr_exit, or NULL on failure
+ */
+EpochGuard *ebr_enter(EpochDomain *domain);
+
+/**
+ * ends a critical section, pointers read inside it must not be used anymore
+ *
+ * @param guard guard returned by ebr_enter
+ */
+void ebr_exit(EpochGuard *guard);
+
+/**
+ * hands an object that is no longer reachable to the domain, `free_fn` is
+ * called on its link once no critical section can still be reading it
+ * (from whichever thread happens to collect it, or in ebr_destroy)
+ *
+ * @param guard guard of the current critical section
+ * @param link link embedded in the retired object
+ * @param free_fn function releasing the object
+ * @return EBR_OK on success, EBR_ERR on invalid arguments
+ */
+int ebr_retire(EpochGuard *guard, EBRLink *link, void (*free_fn)(EBRLink *link));
+
+#endif // EPOCH_RECLAIM_H
@@ -33,6 +33,32 @@ typedef int (*heap_cmp_fn)(const void *a, const void *b);
  */
 Heap *heap_create(size_t elem_size, heap_cmp_fn cmp);
 
+/**
+ * creates a new d-ary heap: every node has `arity` children instead of 2
+ * a wider node makes the tree shallower (fewer levels, fewer cache lines
+ * touched when sifting) at the cost of more comparisons per level, 4 is
+ * usually the sweet spot for small elements
+ *
+ * @param elem_size size of each element in bytes
+ * @param cmp comparison function for heap ordering
+ * @param arity number of children per node, from 2 to 16
+ * @return pointer to created heap, or NULL on failure
+ */
+Heap *heap_create_arity(size_t elem_size, heap_cmp_fn cmp, size_t arity);
+
+/**
+ * creates a new heap holding a copy of the `n` elements of `base`
+ * the buffer is copied once and heapified bottom-up (Floyd) in O(n),
+ * instead of n insertions in O(n log n)
+ *
+ * @param base pointer to the first element (may be NULL if `n` is 0)
+ * @param n number of elements
+ * @param elem_size size of each element in bytes
+ * @param cmp comparison function for heap ordering
+ * @return pointer to created heap, or NULL on failure
+ */
+Heap *heap_create_from(const void *base, size_t n, size_t elem_size, heap_cmp_fn cmp);
+
 /**
  * destroys the heap and frees associated memory
  */
@@ -68,6 +94,11 @@ void *heap_peek(const Heap *h);
  */
 size_t heap_size(const Heap *h);
 
+/**
+ * returns the number of children per node (0 if the heap is invalid)
+ */
+size_t heap_arity(const Heap *h);
+
 /**
  * returns non-zero if the heap is empty or invalid
  */
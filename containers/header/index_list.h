@@ -0,0 +1,264 @@
+#ifndef INDEX_LIST_H
+#define INDEX_LIST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* status codes */
+#define IXL_OK   0   // operation successful
+#define IXL_ERR -1   // operation failed
+
+/**
+ * opaque index-based doubly linked list type
+ * elements live in one growable array and are linked with 32-bit slot indices
+ * (8 bytes of links per element, no per-node allocation), freed slots are
+ * recycled through a free chain
+ * holds fewer than 2^31 elements
+ */
+typedef struct IndexList IndexList;
+
+/**
+ * comparison function used to order elements
+ * returns negative if a < b, 0 if equal, positive if a > b
+ */
+typedef int (*ixl_cmp_fn)(const void *a, const void *b);
+
+/**
+ * cursor: a position inside a list, used to walk and edit it in O(1) per step
+ * besides elements, a cursor can sit on the end position, which is both
+ * before the first element and after the last one
+ * a cursor stays valid until the element it sits on is removed by another call
+ */
+typedef struct IXLCursor {
+    IndexList *list;    // list the cursor walks
+    uint32_t slot;      // current position (private, don't touch)
+} IXLCursor;
+
+/* constructor / destructor */
+
+/**
+ * creates a new index list with elements of size `elem_size`
+ *
+ * @param elem_size size of each element in bytes
+ * @return pointer to the newly created list, or NULL on failure
+ */
+IndexList *ixl_create(size_t elem_size);
+
+/**
+ * frees all memory used by the list
+ *
+ * @param list pointer to the list to destroy
+ */
+void ixl_destroy(IndexList *list);
+
+
+/* insertion */
+
+/**
+ * inserts an element at the front of the list (amortized constant time)
+ *
+ * @param list pointer to the list
+ * @param src pointer to the element to insert
+ * @return IXL_OK on success, IXL_ERR on failure
+ */
+int ixl_push_front(IndexList *list, const void *src);
+
+/**
+ * inserts an element at the back of the list (amortized constant time)
+ *
+ * @param list pointer to the list
+ * @param src pointer to the element to insert
+ * @return IXL_OK on success, IXL_ERR on failure
+ */
+int ixl_push_back(IndexList *list, const void *src);
+
+/**
+ * inserts an element at the given index (0-indexed)
+ *
+ * @param list pointer to the list
+ * @param index position at which to insert
+ * @param src pointer to the element to insert
+ * @return IXL_OK on success, IXL_ERR on failure
+ */
+int ixl_insert_at(IndexList *list, size_t index, const void *src);
+
+
+/* deletion */
+
+/**
+ * removes the front element from the list (constant time)
+ *
+ * @param list pointer to the list
+ * @return IXL_OK on success, IXL_ERR on failure (or if the list is empty)
+ */
+int ixl_pop_front(IndexList *list);
+
+/**
+ * removes the last element from the list (constant time)
+ *
+ * @param list pointer to the list
+ * @return IXL_OK on success, IXL_ERR on failure (or if the list is empty)
+ */
+int ixl_pop_back(IndexList *list);
+
+/**
+ * removes the element at the given index (0-indexed)
+ *
+ * @param list pointer to the list
+ * @param index position of the element to remove
+ * @return IXL_OK on success, IXL_ERR on failure
+ */
+int ixl_remove_at(IndexList *list, size_t index);
+
+
+/* access */
+
+/**
+ * returns a pointer to the front element
+ *
+ * @param list pointer to the list
+ * @return pointer to the front element, or NULL if list is empty
+ * @note the pointer is invalidated when an insertion grows the backing array
+ */
+void *ixl_front(const IndexList *list);
+
+/**
+ * returns a pointer to the last element
+ *
+ * @param list pointer to the list
+ * @return pointer to the last element, or NULL if list is empty
+ * @note the pointer is invalidated when an insertion grows the backing array
+ */
+void *ixl_back(const IndexList *list);
+
+/**
+ * returns a pointer to the element at the given index (0-indexed)
+ * sequential indices reuse the last position reached
+ *
+ * @param list pointer to the list
+ * @param index position of the element to retrieve
+ * @return pointer to the element, or NULL if out of bounds
+ * @note the pointer is invalidated when an insertion grows the backing array
+ * @note remembering the last position reached writes to the list: concurrent
+ *       calls on one list need the same locking as modifiers
+ */
+void *ixl_get(IndexList *list, size_t index);
+
+
+/* utilities */
+
+/**
+ * returns the number of elements in the list
+ *
+ * @param list pointer to the list
+ * @return number of elements
+ */
+size_t ixl_size(const IndexList *list);
+
+/**
+ * checks if the list is empty
+ *
+ * @param list pointer to the list
+ * @return non-zero if empty, 0 otherwise
+ */
+int ixl_is_empty(const IndexList *list);
+
+/**
+ * clears the list contents (size becomes 0), the backing array is kept
+ *
+ * @param list pointer to the list
+ */
+void ixl_clear(IndexList *list);
+
+/**
+ * sorts the list in place with a stable bottom-up merge sort, O(n log n)
+ * only the links are rewritten, elements don't move
+ *
+ * @param list pointer to the list
+ * @param cmp comparison function
+ * @return IXL_OK on success, IXL_ERR on failure
+ */
+int ixl_sort(IndexList *list, ixl_cmp_fn cmp);
+
+
+/* cursor */
+
+/**
+ * returns a cursor on the first element (on the end position if the list is empty)
+ *
+ * @param list pointer to the list
+ * @return the cursor (its list is NULL if `list` is invalid)
+ */
+IXLCursor ixl_cursor_begin(IndexList *list);
+
+/**
+ * returns a cursor on the last element (on the end position if the list is empty)
+ *
+ * @param list pointer to the list
+ * @return the cursor (its list is NULL if `list` is invalid)
+ */
+IXLCursor ixl_cursor_last(IndexList *list);
+
+/**
+ * checks whether the cursor sits on the end position (no element under it)
+ *
+ * @param cur pointer to the cursor
+ * @return non-zero if on the end position or invalid, 0 otherwise
+ */
+int ixl_cursor_is_end(const IXLCursor *cur);
+
+/**
+ * moves the cursor to the next element (or to the end position) in constant time O(1)
+ *
+ * @param cur pointer to the cursor
+ * @return IXL_OK on success, IXL_ERR if already on the end position
+ */
+int ixl_cursor_next(IXLCursor *cur);
+
+/**
+ * moves the cursor to the previous element in constant time O(1)
+ * from the end position, it moves to the last element
+ *
+ * @param cur pointer to the cursor
+ * @return IXL_OK on success, IXL_ERR if already on the first element (or the list is empty)
+ */
+int ixl_cursor_prev(IXLCursor *cur);
+
+/**
+ * returns a pointer to the element under the cursor
+ *
+ * @param cur pointer to the cursor
+ * @return pointer to the element, or NULL on the end position
+ */
+void *ixl_cursor_get(const IXLCursor *cur);
+
+/**
+ * inserts an element right before the cursor (amortized constant time)
+ * the cursor keeps sitting on the same element (on the end position: appends)
+ *
+ * @param cur pointer to the cursor
+ * @param src pointer to the element to insert
+ * @return IXL_OK on success, IXL_ERR on failure
+ */
+int ixl_cursor_insert_before(IXLCursor *cur, const void *src);
+
+/**
+ * inserts an element right after the cursor (amortized constant time)
+ * the cursor keeps sitting on the same element (on the end position: prepends)
+ *
+ * @param cur pointer to the cursor
+ * @param src pointer to the element to insert
+ * @return IXL_OK on success, IXL_ERR on failure
+ */
+int ixl_cursor_insert_after(IXLCursor *cur, const void *src);
+
+/**
+ * removes the element under the cursor in constant time O(1)
+ * the cursor moves to the following element (or to the end position)
+ *
+ * @param cur pointer to the cursor
+ * @return IXL_OK on success, IXL_ERR on failure (or on the end position)
+ */
+int ixl_cursor_erase(IXLCursor *cur);
+
+#endif // INDEX_LIST_H
@@ -0,0 +1,125 @@
+#ifndef INDEXED_PQ_H
+#define INDEXED_PQ_H
+
+#include <stddef.h>
+
+#define IPQ_OK    0
+#define IPQ_ERR  -1
+
+#define IPQ_NO_HANDLE ((size_t)-1)   // returned by ipq_push / ipq_top_handle on failure
+
+/**
+ * opaque indexed priority queue type
+ * every pushed element gets a handle that stays valid until the element is
+ * popped or removed, so its priority can be changed in place instead of
+ * pushing a duplicate and skipping the stale entry later
+ *
+ * elements live in slots indexed by their handle and never move; the binary
+ * heap only holds handles, and a position map gives the heap index of each
+ * handle, so update / remove / contains don't search
+ *
+ * handles are small integers, reused once their element leaves the queue
+ */
+typedef struct IndexedPQ IndexedPQ;
+
+/**
+ * comparison function used to order elements
+ * must return:
+ *   < 0 if a has higher priority than b
+ *     0 if equal
+ *   > 0 if b has higher priority than a
+ */
+typedef int (*ipq_cmp_fn)(const void *a, const void *b);
+
+/**
+ * creates a new indexed priority queue
+ *
+ * @param elem_size size of each element
+ * @param cmp comparator function (min-heap or max-heap)
+ * @return pointer to the queue or NULL on failure
+ */
+IndexedPQ *ipq_create(size_t elem_size, ipq_cmp_fn cmp);
+
+/**
+ * destroys the queue and releases memory
+ */
+void ipq_destroy(IndexedPQ *ipq);
+
+/**
+ * inserts a copy of `elem` in O(log n)
+ *
+ * @param ipq pointer to the queue
+ * @param elem pointer to the element to insert
+ * @return the element's handle, or IPQ_NO_HANDLE on failure
+ */
+size_t ipq_push(IndexedPQ *ipq, const void *elem);
+
+/**
+ * removes the element with highest priority in O(log n), its handle is released
+ *
+ * @param ipq pointer to the queue
+ * @return IPQ_OK on success, IPQ_ERR if empty
+ */
+int ipq_pop(IndexedPQ *ipq);
+
+/**
+ * replaces the element of `handle` with a copy of `elem` and restores the
+ * order in O(log n), whether its priority went up or down
+ *
+ * @param ipq pointer to the queue
+ * @param handle handle returned by ipq_push
+ * @param elem pointer to the new value
+ * @return IPQ_OK on success, IPQ_ERR if the handle is not in the queue
+ */
+int ipq_update(IndexedPQ *ipq, size_t handle, const void *elem);
+
+/**
+ * removes the element of `handle` in O(log n), the handle is released
+ *
+ * @param ipq pointer to the queue
+ * @param handle handle returned by ipq_push
+ * @return IPQ_OK on success, IPQ_ERR if the handle is not in the queue
+ */
+int ipq_remove(IndexedPQ *ipq, size_t handle);
+
+/**
+ * checks in O(1) whether `handle` refers to an element of the queue
+ *
+ * @return non-zero if it does, 0 otherwise
+ */
+int ipq_contains(const IndexedPQ *ipq, size_t handle);
+
+/**
+ * returns a pointer to the element of `handle`
+ * after changing it in place, call ipq_update with the same pointer
+ *
+ * @return pointer to the element, or NULL if the handle is not in the queue
+ * @note the pointer is invalidated by the next ipq_push
+ */
+void *ipq_get(const IndexedPQ *ipq, size_t handle);
+
+/**
+ * returns a pointer to the top (highest priority) element
+ *
+ * @note the pointer is invalidated by the next ipq_push
+ */
+void *ipq_top(const IndexedPQ *ipq);
+
+/**
+ * returns the handle of the top (highest priority) element
+ *
+ * @return the handle, or IPQ_NO_HANDLE if empty
+ */
+size_t ipq_top_handle(const IndexedPQ *ipq);
+
+/**
+ * returns the number of elements in the queue
+ */
+size_t ipq_size(const IndexedPQ *ipq);
+
+/**
+ * returns non-zero if the queue is empty or invalid
+ */
+int ipq_is_empty(const IndexedPQ *ipq);
+
+#endif // INDEXED_PQ_H
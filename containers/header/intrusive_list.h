@@ -0,0 +1,218 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <stddef.h>
+
+/* status codes */
+#define ILIST_OK   0   // operation successful
+#define ILIST_ERR -1   // operation failed
+
+/**
+ * link embedded by the caller inside its own objects
+ * the list never allocates nor copies: it only rewires these links
+ * a link is either unlinked (both pointers NULL) or in exactly one list
+ */
+typedef struct IListLink {
+    struct IListLink *prev;
+    struct IListLink *next;
+} IListLink;
+
+/**
+ * intrusive doubly linked list (circular, with an embedded sentinel)
+ * the struct is public so it can live inside other objects, but its fields
+ * are private: use the functions below
+ * a list must not be copied or moved in memory while it holds links
+ */
+typedef struct IList {
+    IListLink sentinel;  // sentinel.next is the first link, sentinel.prev the last
+    size_t size;         // number of links in the list
+} IList;
+
+/**
+ * returns a pointer to the object of type `type` whose member `member` is `link`
+ * (container_of), e.g. ILIST_ENTRY(link, struct Job, run_link)
+ */
+#define ILIST_ENTRY(link, type, member) \
+    ((type *)((char *)(link) - offsetof(type, member)))
+
+/* initialization */
+
+/**
+ * initializes an empty list
+ *
+ * @param list pointer to the list
+ */
+void ilist_init(IList *list);
+
+/**
+ * marks a link as unlinked (zero-initialized links are unlinked too)
+ *
+ * @param link pointer to the link
+ */
+void ilist_link_init(IListLink *link);
+
+/**
+ * checks whether the link currently belongs to a list
+ *
+ * @param link pointer to the link
+ * @return non-zero if linked, 0 otherwise (or if invalid)
+ */
+int ilist_is_linked(const IListLink *link);
+
+
+/* insertion (the link must be unlinked) */
+
+/**
+ * links `link` at the front of the list in constant time O(1)
+ *
+ * @param list pointer to the list
+ * @param link pointer to an unlinked link
+ * @return ILIST_OK on success, ILIST_ERR on failure
+ */
+int ilist_push_front(IList *list, IListLink *link);
+
+/**
+ * links `link` at the back of the list in constant time O(1)
+ *
+ * @param list pointer to the list
+ * @param link pointer to an unlinked link
+ * @return ILIST_OK on success, ILIST_ERR on failure
+ */
+int ilist_push_back(IList *list, IListLink *link);
+
+/**
+ * links `link` right before `pos` (which must belong to `list`) in constant time O(1)
+ *
+ * @param list pointer to the list
+ * @param pos pointer to a link of the list
+ * @param link pointer to an unlinked link
+ * @return ILIST_OK on success, ILIST_ERR on failure
+ */
+int ilist_insert_before(IList *list, IListLink *pos, IListLink *link);
+
+/**
+ * links `link` right after `pos` (which must belong to `list`) in constant time O(1)
+ *
+ * @param list pointer to the list
+ * @param pos pointer to a link of the list
+ * @param link pointer to an unlinked link
+ * @return ILIST_OK on success, ILIST_ERR on failure
+ */
+int ilist_insert_after(IList *list, IListLink *pos, IListLink *link);
+
+
+/* deletion */
+
+/**
+ * unlinks `link` (which must belong to `list`) in constant time O(1)
+ *
+ * @param list pointer to the list
+ * @param link pointer to a link of the list
+ * @return ILIST_OK on success, ILIST_ERR on failure
+ */
+int ilist_remove(IList *list, IListLink *link);
+
+/**
+ * unlinks and returns the first link
+ *
+ * @param list pointer to the list
+ * @return the unlinked link, or NULL if the list is empty
+ */
+IListLink *ilist_pop_front(IList *list);
+
+/**
+ * unlinks and returns the last link
+ *
+ * @param list pointer to the list
+ * @return the unlinked link, or NULL if the list is empty
+ */
+IListLink *ilist_pop_back(IList *list);
+
+
+/* moving (`dst` and `src` may be the same list) */
+
+/**
+ * moves `link` from `src` to the front of `dst` in constant time O(1)
+ * (with dst == src, this is the LRU "touch" operation)
+ *
+ * @param dst pointer to the destination list
+ * @param src pointer to the list `link` belongs to
+ * @param link pointer to a link of `src`
+ * @return ILIST_OK on success, ILIST_ERR on failure
+ */
+int ilist_move_to_front(IList *dst, IList *src, IListLink *link);
+
+/**
+ * moves `link` from `src` to the back of `dst` in constant time O(1)
+ *
+ * @param dst pointer to the destination list
+ * @param src pointer to the list `link` belongs to
+ * @param link pointer to a link of `src`
+ * @return ILIST_OK on success, ILIST_ERR on failure
+ */
+int ilist_move_to_back(IList *dst, IList *src, IListLink *link);
+
+
+/* access */
+
+/**
+ * returns the first link
+ *
+ * @param list pointer to the list
+ * @return pointer to the first link, or NULL if the list is empty
+ */
+IListLink *ilist_front(const IList *list);
+
+/**
+ * returns the last link
+ *
+ * @param list pointer to the list
+ * @return pointer to the last link, or NULL if the list is empty
+ */
+IListLink *ilist_back(const IList *list);
+
+/**
+ * returns the link following `link`
+ *
+ * @param list pointer to the list `link` belongs to
+ * @param link pointer to a link of the list
+ * @return pointer to the next link, or NULL if `link` is the last one
+ */
+IListLink *ilist_next(const IList *list, const IListLink *link);
+
+/**
+ * returns the link preceding `link`
+ *
+ * @param list pointer to the list `link` belongs to
+ * @param link pointer to a link of the list
+ * @return pointer to the previous link, or NULL if `link` is the first one
+ */
+IListLink *ilist_prev(const IList *list, const IListLink *link);
+
+
+/* utilities */
+
+/**
+ * returns the number of links in the list
+ *
+ * @param list pointer to the list
+ * @return number of links
+ */
+size_t ilist_size(const IList *list);
+
+/**
+ * checks if the list is empty
+ *
+ * @param list pointer to the list
+ * @return non-zero if empty, 0 otherwise
+ */
+int ilist_is_empty(const IList *list);
+
+/**
+ * unlinks every link (size becomes 0), the objects themselves are untouched
+ *
+ * @param list pointer to the list
+ */
+void ilist_clear(IList *list);
+
+#endif // INTRUSIVE_LIST_H
@@ -0,0 +1,118 @@
+#ifndef LOCKFREE_LIST_H
+#define LOCKFREE_LIST_H
+
+#include <stddef.h>
+
+/* status codes */
+#define LFL_OK   0   // operation successful
+#define LFL_ERR -1   // operation failed (or nothing to remove / not found)
+
+/**
+ * opaque lock-free singly linked list type (Harris / Michael)
+ * every operation is safe to call from any number of threads at once
+ * a node is removed in two steps: its `next` link is marked first (logical
+ * deletion), then it is unlinked by whichever thread gets there, and handed
+ * to the list's epoch reclamation domain (see epoch_reclaim.h)
+ *
+ * elements are copied in and out: a pointer into the list would dangle as
+ * soon as another thread removes the element
+ *
+ * lfl_insert keeps the list sorted as long as it isn't mixed with
+ * lfl_push_front
+ */
+typedef struct LockFreeList LockFreeList;
+
+/**
+ * comparison function used to order elements
+ * returns negative if a < b, 0 if equal, positive if a > b
+ */
+typedef int (*lfl_cmp_fn)(const void *a, const void *b);
+
+/* constructor / destructor */
+
+/**
+ * creates a new lock-free list
+ *
+ * @param elem_size size of each element in bytes
+ * @param cmp comparison function, may be NULL if only push_front / pop_front are used
+ * @return pointer to the newly created list, or NULL on failure
+ */
+LockFreeList *lfl_create(size_t elem_size, lfl_cmp_fn cmp);
+
+/**
+ * frees all memory used by the list (no other thread may use it anymore)
+ *
+ * @param list pointer to the list to destroy
+ */
+void lfl_destroy(LockFreeList *list);
+
+
+/* modifiers */
+
+/**
+ * inserts a copy of `elem` at the front of the list
+ *
+ * @param list pointer to the list
+ * @param elem pointer to the element to insert
+ * @return LFL_OK on success, LFL_ERR on failure
+ */
+int lfl_push_front(LockFreeList *list, const void *elem);
+
+/**
+ * removes the front element, copying it to `out`
+ *
+ * @param list pointer to the list
+ * @param out where to copy the removed element (may be NULL)
+ * @return LFL_OK on success, LFL_ERR on failure (or if the list is empty)
+ */
+int lfl_pop_front(LockFreeList *list, void *out);
+
+/**
+ * inserts a copy of `elem` before the first element not less than it
+ *
+ * @param list pointer to the list (created with a comparator)
+ * @param elem pointer to the element to insert
+ * @return LFL_OK on success, LFL_ERR on failure
+ */
+int lfl_insert(LockFreeList *list, const void *elem);
+
+/**
+ * removes the first element equal to `key` (searching the sorted prefix)
+ *
+ * @param list pointer to the list (created with a comparator)
+ * @param key pointer to the element to compare against
+ * @return LFL_OK on success, LFL_ERR on failure (or if not found)
+ */
+int lfl_erase(LockFreeList *list, const void *key);
+
+
+/* lookup */
+
+/**
+ * looks for the first element equal to `key` (searching the sorted prefix)
+ *
+ * @param list pointer to the list (created with a comparator)
+ * @param key pointer to the element to compare against
+ * @param out where to copy the element found (may be NULL)
+ * @return LFL_OK if found, LFL_ERR otherwise
+ */
+int lfl_find(LockFreeList *list, const void *key, void *out);
+
+/**
+ * returns the number of elements in the list
+ * the value is a snapshot when other threads modify the list concurrently
+ *
+ * @param list pointer to the list
+ * @return number of elements
+ */
+size_t lfl_size(const LockFreeList *list);
+
+/**
+ * checks if the list is empty (a snapshot, see lfl_size)
+ *
+ * @param list pointer to the list
+ * @return non-zero if empty, 0 otherwise
+ */
+int lfl_is_empty(const LockFreeList *list);
+
+#endif // LOCKFREE_LIST_H
@@ -0,0 +1,84 @@
+#ifndef MINMAX_HEAP_H
+#define MINMAX_HEAP_H
+
+#include <stddef.h>
+#include "heap.h"
+
+#define MMH_OK    0
+#define MMH_ERR  -1
+
+/**
+ * opaque min-max heap type (double-ended priority queue)
+ * a binary tree in a flat array whose levels alternate: every node of an
+ * even level (the root's) is the smallest of its subtree, every node of an
+ * odd level the largest
+ * the smallest element is the root, the largest one of its two children,
+ * so one array serves both ends
+ */
+typedef struct MinMaxHeap MinMaxHeap;
+
+/**
+ * creates a new min-max heap
+ *
+ * @param elem_size size of each element
+ * @param cmp comparator (see heap_cmp_fn), in ascending order: "min" is the
+ *        element with the highest priority for a Heap using the same function
+ * @return pointer to the heap or NULL on failure
+ */
+MinMaxHeap *mmh_create(size_t elem_size, heap_cmp_fn cmp);
+
+/**
+ * destroys the heap and releases memory
+ */
+void mmh_destroy(MinMaxHeap *mmh);
+
+/**
+ * inserts a copy of `elem`, in O(log n)
+ *
+ * @param mmh pointer to the heap
+ * @param elem pointer to the element to insert
+ * @return MMH_OK on success, MMH_ERR on failure
+ */
+int mmh_insert(MinMaxHeap *mmh, const void *elem);
+
+/**
+ * removes the smallest element, in O(log n)
+ *
+ * @param mmh pointer to the heap
+ * @return MMH_OK on success, MMH_ERR if empty
+ */
+int mmh_pop_min(MinMaxHeap *mmh);
+
+/**
+ * removes the largest element, in O(log n)
+ *
+ * @param mmh pointer to the heap
+ * @return MMH_OK on success, MMH_ERR if empty
+ */
+int mmh_pop_max(MinMaxHeap *mmh);
+
+/**
+ * returns a pointer to the smallest element, in O(1)
+ *
+ * @return pointer to the element, or NULL if empty
+ */
+void *mmh_peek_min(const MinMaxHeap *mmh);
+
+/**
+ * returns a pointer to the largest element, in O(1)
+ *
+ * @return pointer to the element, or NULL if empty
+ */
+void *mmh_peek_max(const MinMaxHeap *mmh);
+
+/**
+ * returns the number of elements in the heap
+ */
+size_t mmh_size(const MinMaxHeap *mmh);
+
+/**
+ * returns non-zero if the heap is empty or invalid
+ */
+int mmh_is_empty(const MinMaxHeap *mmh);
+
+#endif // MINMAX_HEAP_H
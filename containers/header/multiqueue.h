@@ -0,0 +1,83 @@
+#ifndef MULTIQUEUE_H
+#define MULTIQUEUE_H
+
+#include <stddef.h>
+#include "priority_queue.h"
+
+/* status codes */
+#define MQ_OK    0   // operation successful
+#define MQ_ERR  -1   // operation failed (pop: no element found)
+
+/**
+ * opaque relaxed concurrent priority queue (MultiQueue), safe to use from
+ * any number of threads
+ *
+ * the elements are spread over several PriorityQueues, each behind its own
+ * lock: a push goes to a random queue, a pop takes the better top of two
+ * random queues
+ * the order is approximate (a pop returns one of the best elements, not
+ * always the best one), in exchange the threads rarely wait on each other;
+ * with 2 to 4 queues per thread, the elements popped are typically within
+ * a few multiples of the number of queues from the true top
+ */
+typedef struct MultiQueue MultiQueue;
+
+/* constructor / destructor */
+
+/**
+ * creates a new multiqueue
+ *
+ * @param elem_size size of each element
+ * @param cmp comparator function (see pq_cmp_fn)
+ * @param nqueues number of internal queues (>= 2), typically 2 to 4 per thread
+ * @return pointer to the queue or NULL on failure
+ */
+MultiQueue *mq_create(size_t elem_size, pq_cmp_fn cmp, size_t nqueues);
+
+/**
+ * destroys the multiqueue, no thread may be using it anymore
+ *
+ * @param mq pointer to the queue
+ */
+void mq_destroy(MultiQueue *mq);
+
+
+/* modifiers */
+
+/**
+ * inserts a copy of `elem` into a random internal queue, in O(log n)
+ *
+ * @param mq pointer to the queue
+ * @param elem pointer to the element to insert
+ * @return MQ_OK on success, MQ_ERR on failure
+ */
+int mq_push(MultiQueue *mq, const void *elem);
+
+/**
+ * removes a high priority element and copies it to `out`, in O(log n)
+ * the element is the better top of two random internal queues; when they
+ * keep coming up empty, every queue is scanned once
+ *
+ * @param mq pointer to the queue
+ * @param out buffer of elem_size bytes receiving the element
+ * @return MQ_OK on success, MQ_ERR if every queue was found empty
+ * @note with concurrent pushes, MQ_ERR may be returned while an element
+ *       is being inserted
+ */
+int mq_pop(MultiQueue *mq, void *out);
+
+
+/* lookup */
+
+/**
+ * returns the number of elements, a snapshot when other threads are
+ * pushing or popping concurrently
+ */
+size_t mq_size(const MultiQueue *mq);
+
+/**
+ * returns non-zero if the queue is empty (snapshot) or invalid
+ */
+int mq_is_empty(const MultiQueue *mq);
+
+#endif // MULTIQUEUE_H
@@ -0,0 +1,127 @@
+#ifndef PAIRING_HEAP_H
+#define PAIRING_HEAP_H
+
+#include <stddef.h>
+#include "heap.h"
+
+/* status codes */
+#define PH_OK    0   // operation successful
+#define PH_ERR  -1   // operation failed
+
+/**
+ * opaque pairing heap type
+ * a multiway tree kept in heap order, each node linking to its first child
+ * and next sibling; two heaps are melded by making the root with the lower
+ * priority the first child of the other, in O(1)
+ * the cost is paid by ph_remove_top, which pairs up the children of the old
+ * root left to right, then melds the pairs right to left (amortized O(log n))
+ *
+ * nodes come from a pool (see pool_allocator.h); a meld moves the slabs of
+ * the emptied heap into the receiving heap's pool, so the nodes are linked
+ * in without copying
+ */
+typedef struct PairingHeap PairingHeap;
+
+/**
+ * opaque handle to an element of a pairing heap, used by ph_decrease_key
+ * it stays valid until the element is removed (it follows the element
+ * when its heap is melded into another one)
+ */
+typedef struct PHNode PHNode;
+
+/* constructor / destructor */
+
+/**
+ * creates a new pairing heap
+ *
+ * @param elem_size size of each element
+ * @param cmp comparator function (see heap_cmp_fn: < 0 if a has higher priority)
+ * @return pointer to the heap or NULL on failure
+ */
+PairingHeap *ph_create(size_t elem_size, heap_cmp_fn cmp);
+
+/**
+ * destroys the heap and releases every node
+ *
+ * @param ph pointer to the heap
+ */
+void ph_destroy(PairingHeap *ph);
+
+
+/* modifiers */
+
+/**
+ * inserts a copy of `elem` in O(1)
+ *
+ * @param ph pointer to the heap
+ * @param elem pointer to the element to insert
+ * @return handle to the inserted element, or NULL on failure
+ */
+PHNode *ph_insert(PairingHeap *ph, const void *elem);
+
+/**
+ * removes the element with highest priority, in amortized O(log n)
+ *
+ * @param ph pointer to the heap
+ * @return PH_OK on success, PH_ERR if empty
+ * @note the handle of the removed element becomes invalid
+ */
+int ph_remove_top(PairingHeap *ph);
+
+/**
+ * replaces the element of `node` with a copy of `elem`, which must not have
+ * a lower priority than the current one
+ * the node is cut from its parent and melded back with the root
+ *
+ * @param ph pointer to the heap holding the node
+ * @param node handle returned by ph_insert
+ * @param elem pointer to the new value (may be the node's own value, changed in place)
+ * @return PH_OK on success, PH_ERR on failure (or if `elem` has a lower priority)
+ */
+int ph_decrease_key(PairingHeap *ph, PHNode *node, const void *elem);
+
+/**
+ * moves every element of `src` into `dst` in O(1), without allocation or
+ * copy, `src` is left empty but usable
+ * both heaps must order elements the same way (dst's comparator is kept)
+ * the two heaps share their node pool from then on, so the handles of `src`
+ * stay valid (now in `dst`)
+ *
+ * @param dst pointer to the receiving heap
+ * @param src pointer to the heap to empty
+ * @return PH_OK on success, PH_ERR on failure (element sizes differ)
+ */
+int ph_meld(PairingHeap *dst, PairingHeap *src);
+
+
+/* lookup */
+
+/**
+ * returns a pointer to the top (highest priority) element
+ *
+ * @param ph pointer to the heap
+ * @return pointer to the element, or NULL if empty
+ */
+void *ph_peek(const PairingHeap *ph);
+
+/**
+ * returns a pointer to the element of `node`
+ * it may be changed in place only to raise its priority, followed by
+ * ph_decrease_key with the same pointer
+ *
+ * @param node handle returned by ph_insert
+ * @return pointer to the element, or NULL if `node` is NULL
+ */
+void *ph_value(const PHNode *node);
+
+/**
+ * returns the number of elements in the heap
+ */
+size_t ph_size(const PairingHeap *ph);
+
+/**
+ * returns non-zero if the heap is empty or invalid
+ */
+int ph_is_empty(const PairingHeap *ph);
+
+#endif // PAIRING_HEAP_H
@@ -0,0 +1,123 @@
+#ifndef POOL_ALLOCATOR_H
+#define POOL_ALLOCATOR_H
+
+#include <stddef.h>
+
+/* status codes */
+#define POOL_OK   0   // operation successful
+#define POOL_ERR -1   // operation failed
+
+/**
+ * opaque fixed-size block allocator
+ * blocks are carved out of geometrically growing slabs and recycled through
+ * a free list, so steady-state alloc/free never calls into libc
+ * not thread-safe: use one pool per thread (or protect it externally)
+ */
+typedef struct PoolAllocator PoolAllocator;
+
+/**
+ * creates a new pool handing out blocks of `block_size` bytes
+ * every block is aligned for any object type
+ *
+ * @param block_size size of each block in bytes
+ * @return pointer to the created pool, or NULL on failure
+ */
+PoolAllocator *pool_create(size_t block_size);
+
+/**
+ * drops a reference to the pool, the last one releases every slab at once
+ * and frees the pool itself
+ *
+ * @param pool pointer to the pool
+ * @note once the last reference is dropped, every block handed out by the pool becomes invalid
+ */
+void pool_destroy(PoolAllocator *pool);
+
+/**
+ * returns an uninitialized block (recycled first, carved from a slab otherwise)
+ *
+ * @param pool pointer to the pool
+ * @return pointer to the block, or NULL on failure
+ */
+void *pool_alloc(PoolAllocator *pool);
+
+/**
+ * makes sure the next `nblocks` blocks carved from slabs are contiguous
+ * (a slab big enough for all of them is allocated if needed), recycled
+ * blocks are still handed out first
+ *
+ * @param pool pointer to the pool
+ * @param nblocks number of blocks to reserve
+ * @return POOL_OK on success, POOL_ERR on failure
+ */
+int pool_reserve(PoolAllocator *pool, size_t nblocks);
+
+/**
+ * gives a block back to the pool for reuse (constant time O(1))
+ *
+ * @param pool pointer to the pool the block was allocated from
+ * @param block pointer returned by `pool_alloc` (NULL is ignored)
+ */
+void pool_free(PoolAllocator *pool, void *block);
+
+/**
+ * frees every block of the pool in bulk, without visiting them
+ * the newest (largest) slab is kept for reuse, the others go back to libc
+ * a shared pool is left untouched (its blocks must be freed one by one)
+ *
+ * @param pool pointer to the pool
+ * @note every block handed out by the pool becomes invalid
+ */
+void pool_clear(PoolAllocator *pool);
+
+/**
+ * adds a reference to the pool, so several owners can allocate from it
+ * (each of them calls `pool_destroy` once)
+ *
+ * @param pool pointer to the pool
+ * @return `pool`, or NULL if invalid
+ */
+PoolAllocator *pool_share(PoolAllocator *pool);
+
+/**
+ * checks whether more than one owner references the pool's memory
+ * (pools joined by `pool_absorb` share it until all but one of their owners are gone)
+ *
+ * @param pool pointer to the pool
+ * @return non-zero if shared, 0 otherwise
+ */
+int pool_is_shared(const PoolAllocator *pool);
+
+/**
+ * joins `src` to `dst` (same block size) in constant time O(1): every slab and
+ * free block of `src` moves into `dst`, and `src` forwards its calls to `dst`
+ * from then on, so both handles allocate from and free into the same blocks
+ * (a block may be freed through either) and every block stays valid until the
+ * last reference to either pool is dropped
+ * any two pools can be joined, shared or not; joining pools already joined does nothing
+ *
+ * @param dst pointer to the receiving pool
+ * @param src pointer to the pool to join to it
+ * @return POOL_OK on success, POOL_ERR on failure (same handle, block sizes differ)
+ */
+int pool_absorb(PoolAllocator *dst, PoolAllocator *src);
+
+/**
+ * checks whether `block` lies in one of the pool's slabs, in O(number of slabs)
+ *
+ * @param pool pointer to the pool
+ * @param block pointer to check
+ * @return non-zero if the pool owns the block, 0 otherwise
+ */
+int pool_owns(const PoolAllocator *pool, const void *block);
+
+/**
+ * returns the size of the blocks handed out by the pool
+ * (the requested size rounded up for alignment)
+ *
+ * @param pool pointer to the pool
+ * @return block size in bytes, or 0 if the pool is invalid
+ */
+size_t pool_block_size(const PoolAllocator *pool);
+
+#endif // POOL_ALLOCATOR_H
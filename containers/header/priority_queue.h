@@ -31,6 +31,28 @@ typedef int (*pq_cmp_fn)(const void *a, const void *b);
  */
 PriorityQueue *pq_create(size_t elem_size, pq_cmp_fn cmp);
 
+/**
+ * creates a new priority queue backed by a d-ary heap (see heap_create_arity)
+ *
+ * @param elem_size size of each element
+ * @param cmp comparator function (min-heap or max-heap)
+ * @param arity number of children per heap node, from 2 to 16
+ * @return pointer to the queue or NULL on failure
+ */
+PriorityQueue *pq_create_arity(size_t elem_size, pq_cmp_fn cmp, size_t arity);
+
+/**
+ * creates a new priority queue holding a copy of the `n` elements of `base`
+ * the buffer is copied once and heapified bottom-up in O(n)
+ *
+ * @param base pointer to the first element (may be NULL if `n` is 0)
+ * @param n number of elements
+ * @param elem_size size of each element
+ * @param cmp comparator function (min-heap or max-heap)
+ * @return pointer to the queue or NULL on failure
+ */
+PriorityQueue *pq_create_from(const void *base, size_t n, size_t elem_size, pq_cmp_fn cmp);
+
 /**
  * destroys the priority queue and releases memory
  */
@@ -0,0 +1,99 @@
+#ifndef RADIX_HEAP_H
+#define RADIX_HEAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* status codes */
+#define RH_OK    0   // operation successful
+#define RH_ERR  -1   // operation failed (or empty, or key below the last popped one)
+
+/**
+ * opaque radix heap type: a monotone min-priority queue on integer keys
+ * every key pushed must be at least the last key popped (event timestamps,
+ * Dijkstra distances...), in exchange no comparator is ever called
+ *
+ * an entry with key k sits in bucket bit_length(k ^ last), where `last` is
+ * the last key popped: bucket 0 holds keys equal to `last`, bucket b keys
+ * that first differ from it at bit b - 1
+ * when bucket 0 runs dry, the minimum of the first non-empty bucket (kept
+ * up to date by the pushes) becomes `last`, and its entries are spread over
+ * the lower buckets; an entry only ever moves down, so each one is moved
+ * at most 64 times (amortized O(log C) per entry for keys spanning a range
+ * of C)
+ *
+ * each key carries a payload of `elem_size` bytes, copied in and out
+ */
+typedef struct RadixHeap RadixHeap;
+
+/* constructor / destructor */
+
+/**
+ * creates a new radix heap
+ *
+ * @param elem_size size of the payload attached to each key (0 for keys only)
+ * @return pointer to the heap or NULL on failure
+ */
+RadixHeap *rh_create(size_t elem_size);
+
+/**
+ * destroys the heap and releases memory
+ *
+ * @param rh pointer to the heap
+ */
+void rh_destroy(RadixHeap *rh);
+
+
+/* modifiers */
+
+/**
+ * inserts `key` with a copy of its payload, in O(1)
+ *
+ * @param rh pointer to the heap
+ * @param key the key, not less than rh_last
+ * @param elem pointer to the payload (ignored if elem_size is 0)
+ * @return RH_OK on success, RH_ERR on failure (or if `key` < rh_last)
+ */
+int rh_push(RadixHeap *rh, uint64_t key, const void *elem);
+
+/**
+ * removes an entry with the smallest key, in amortized O(log C)
+ *
+ * @param rh pointer to the heap
+ * @param key where to store the key (may be NULL)
+ * @param out where to copy the payload (may be NULL)
+ * @return RH_OK on success, RH_ERR if empty (or out of memory)
+ */
+int rh_pop(RadixHeap *rh, uint64_t *key, void *out);
+
+
+/* lookup */
+
+/**
+ * reads an entry with the smallest key without removing it (the next one
+ * rh_pop returns), the buckets may be redistributed to find it
+ *
+ * @param rh pointer to the heap
+ * @param key where to store the key (may be NULL)
+ * @param out where to copy the payload (may be NULL)
+ * @return RH_OK on success, RH_ERR if empty (or out of memory)
+ */
+int rh_top(RadixHeap *rh, uint64_t *key, void *out);
+
+/**
+ * returns the lower bound for new keys: the last key popped (or found by
+ * rh_top), 0 at first
+ */
+uint64_t rh_last(const RadixHeap *rh);
+
+/**
+ * returns the number of entries in the heap
+ */
+size_t rh_size(const RadixHeap *rh);
+
+/**
+ * returns non-zero if the heap is empty or invalid
+ */
+int rh_is_empty(const RadixHeap *rh);
+
+#endif // RADIX_HEAP_H
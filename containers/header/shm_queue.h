@@ -0,0 +1,102 @@
+#ifndef SHM_QUEUE_H
+# define SHM_QUEUE_H
+
+# include <stddef.h>
+
+# define SHMQ_OK    0   // indicates a successful queue operation
+# define SHMQ_ERR  -1   // indicates a failed queue operation (or a full/empty queue)
+
+/**
+ * opaque structure representing a process-local handle to a shared-memory queue
+ * the ring buffer and its indices live in a POSIX shared memory object, so any
+ * process that knows the name can attach to it and exchange fixed-size elements
+ * (multiple producers and multiple consumers are supported)
+ */
+typedef struct ShmQueue ShmQueue;
+
+/**
+ * creates a new shared memory object called `name` and initializes a queue in it
+ *
+ * @param name POSIX shared memory name (e.g. "/my_queue"), must not exist yet
+ * @param capacity maximum number of elements (rounded up to a power of two)
+ * @param elem_size size in bytes of each element
+ * @return pointer to the created queue handle, or NULL on failure
+ */
+ShmQueue *shmq_create(const char *name, size_t capacity, size_t elem_size);
+
+/**
+ * attaches to an existing queue created by `shmq_create` (in any process)
+ *
+ * @param name POSIX shared memory name the queue was created with
+ * @return pointer to the queue handle, or NULL on failure (missing or not initialized yet)
+ */
+ShmQueue *shmq_open(const char *name);
+
+/**
+ * detaches from the queue and frees the process-local handle
+ * the shared memory object itself stays alive until `shmq_unlink` is called
+ *
+ * @param q pointer to the queue handle
+ */
+void shmq_close(ShmQueue *q);
+
+/**
+ * removes the shared memory name, processes still attached keep their mapping
+ *
+ * @param name POSIX shared memory name
+ * @return SHMQ_OK on success, SHMQ_ERR on failure
+ */
+int shmq_unlink(const char *name);
+
+/**
+ * copies an element into the back of the queue (lock-free, never blocks)
+ *
+ * @param q pointer to the queue handle
+ * @param elem pointer to the element to enqueue
+ * @return SHMQ_OK on success, SHMQ_ERR if the queue is full or invalid
+ */
+int shmq_enqueue(ShmQueue *q, const void *elem);
+
+/**
+ * copies the front element into `dst` and removes it (lock-free, never blocks)
+ *
+ * @param q pointer to the queue handle
+ * @param dst pointer to a buffer of at least elem_size bytes
+ * @return SHMQ_OK on success, SHMQ_ERR if the queue is empty or invalid
+ */
+int shmq_dequeue(ShmQueue *q, void *dst);
+
+/**
+ * returns the number of elements in the queue
+ * the value is a snapshot, other processes may change it concurrently
+ *
+ * @param q pointer to the queue handle
+ * @return number of elements, or 0 if the queue is invalid
+ */
+size_t shmq_size(const ShmQueue *q);
+
+/**
+ * returns the maximum number of elements the queue can hold
+ *
+ * @param q pointer to the queue handle
+ * @return capacity, or 0 if the queue is invalid
+ */
+size_t shmq_capacity(const ShmQueue *q);
+
+/**
+ * returns the element size the queue was created with
+ *
+ * @param q pointer to the queue handle
+ * @return element size in bytes, or 0 if the queue is invalid
+ */
+size_t shmq_elem_size(const ShmQueue *q);
+
+/**
+ * checks whether the queue is empty
+ *
+ * @param q pointer to the queue handle
+ * @return non-zero if empty or invalid, 0 otherwise
+ */
+int shmq_is_empty(const ShmQueue *q);
+
+#endif // SHM_QUEUE_H
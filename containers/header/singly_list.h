@@ -6,10 +6,28 @@
 /* status codes */
 #define SL_OK   0   // operation successful
 #define SL_ERR -1   // operation failed
+#define SL_PENDING 1   // compaction in progress, call again
 
 /* opaque singly linked list type */
 typedef struct SinglyList SinglyList;
 
+/**
+ * comparison function used to order elements
+ * returns negative if a < b, 0 if equal, positive if a > b
+ */
+typedef int (*sl_cmp_fn)(const void *a, const void *b);
+
+/**
+ * forward cursor: a position inside a list, used to walk and edit it in O(1) per step
+ * it remembers the previous node, so it can insert before and erase the current one
+ * a cursor stays valid until the list is changed by anything other than this cursor
+ */
+typedef struct SLCursor {
+    SinglyList *list;       // list the cursor walks
+    struct SLNode *prev;    // node before the current one (private, don't touch)
+    struct SLNode *node;    // current node, NULL past the end (private, don't touch)
+} SLCursor;
+
 /* constructor / destructor */
 
 /**
@@ -20,6 +38,17 @@ typedef struct SinglyList SinglyList;
  */
 SinglyList *sl_create(size_t elem_size);
 
+/**
+ * creates a new singly linked list holding a copy of `count` elements of
+ * `src`, in order, with all the nodes carved from one contiguous block
+ *
+ * @param elem_size size of each element in bytes
+ * @param src pointer to the first element of the array (may be NULL if `count` is 0)
+ * @param count number of elements in the array
+ * @return pointer to the newly created list, or NULL on failure
+ */
+SinglyList *sl_from_array(size_t elem_size, const void *src, size_t count);
+
 /**
  * frees all memory used by the list
  *
@@ -99,12 +128,16 @@ void *sl_back(const SinglyList *list);
 
 /**
  * returns a pointer to the element at the given index
+ * the walk starts from the last index reached when it's not past `index`,
+ * so getting increasing indices is O(1) each
  *
  * @param list pointer to the singly list
  * @param index position of the element to retrieve (0-indexed)
  * @return pointer to the element, or NULL if out of bounds
+ * @note remembering the last index reached writes to the list: concurrent
+ *       calls on one list need the same locking as modifiers
  */
-void *sl_get(const SinglyList *list, size_t index);
+void *sl_get(SinglyList *list, size_t index);
 
 
 /* utilities */
@@ -125,6 +158,16 @@ size_t sl_size(const SinglyList *list);
  */
 int sl_is_empty(const SinglyList *list);
 
+/**
+ * copies the elements, in order, into the array `dst` in one walk
+ *
+ * @param list pointer to the singly list
+ * @param dst array receiving the elements
+ * @param capacity number of elements `dst` can hold
+ * @return number of elements copied (at most `capacity`)
+ */
+size_t sl_to_array(const SinglyList *list, void *dst, size_t capacity);
+
 /**
  * clears the list contents (size becomes 0)
  *
@@ -132,4 +175,108 @@ int sl_is_empty(const SinglyList *list);
  */
 void sl_clear(SinglyList *list);
 
+
+/* cursor */
+
+/**
+ * returns a cursor on the first element (past the end if the list is empty)
+ *
+ * @param list pointer to the singly list
+ * @return the cursor (its list is NULL if `list` is invalid)
+ */
+SLCursor sl_cursor_begin(SinglyList *list);
+
+/**
+ * checks whether the cursor is past the last element
+ *
+ * @param cur pointer to the cursor
+ * @return non-zero if past the end or invalid, 0 otherwise
+ */
+int sl_cursor_is_end(const SLCursor *cur);
+
+/**
+ * moves the cursor to the next element (or past the last one) in constant time O(1)
+ *
+ * @param cur pointer to the cursor
+ * @return SL_OK on success, SL_ERR if already past the end
+ */
+int sl_cursor_next(SLCursor *cur);
+
+/**
+ * returns a pointer to the element under the cursor
+ *
+ * @param cur pointer to the cursor
+ * @return pointer to the element, or NULL past the end
+ */
+void *sl_cursor_get(const SLCursor *cur);
+
+/**
+ * inserts an element right before the cursor in constant time O(1)
+ * the cursor keeps sitting on the same element (past the end: appends)
+ *
+ * @param cur pointer to the cursor
+ * @param src pointer to the element to insert
+ * @return SL_OK on success, SL_ERR on failure
+ */
+int sl_cursor_insert_before(SLCursor *cur, const void *src);
+
+/**
+ * inserts an element right after the cursor in constant time O(1)
+ * the cursor keeps sitting on the same element
+ *
+ * @param cur pointer to the cursor
+ * @param src pointer to the element to insert
+ * @return SL_OK on success, SL_ERR on failure (or past the end)
+ */
+int sl_cursor_insert_after(SLCursor *cur, const void *src);
+
+/**
+ * removes the element under the cursor in constant time O(1)
+ * the cursor moves to the following element (or past the last one)
+ *
+ * @param cur pointer to the cursor
+ * @return SL_OK on success, SL_ERR on failure (or past the end)
+ */
+int sl_cursor_erase(SLCursor *cur);
+
+
+/* sort */
+
+/**
+ * sorts the list in place with a stable bottom-up merge sort, O(n log n)
+ * nodes are relinked: no allocation, no element copy
+ *
+ * @param list pointer to the singly list
+ * @param cmp comparison function
+ * @return SL_OK on success, SL_ERR on failure
+ * @note cursors become invalid (their `prev` node changes)
+ */
+int sl_sort(SinglyList *list, sl_cmp_fn cmp);
+
+
+
+/* compaction */
+
+/**
+ * moves every node, in traversal order, into one contiguous slab so that a
+ * full walk touches memory sequentially again (finishes a compaction in progress)
+ *
+ * @param list pointer to the singly list
+ * @return SL_OK on success, SL_ERR on failure
+ * @note pointers to elements and cursors become invalid
+ */
+int sl_compact(SinglyList *list);
+
+/**
+ * same as `sl_compact`, but visits at most `max_nodes` nodes per call
+ * the list can be used and modified between two steps
+ *
+ * @param list pointer to the singly list
+ * @param max_nodes upper bound of nodes visited by this call
+ * @return SL_OK once compacted, SL_PENDING if more steps are needed, SL_ERR on failure
+ * @note pointers to elements and cursors on visited nodes become invalid;
+ *       sort restarts the walk, clear stops the compaction
+ */
+int sl_compact_step(SinglyList *list, size_t max_nodes);
+
 #endif // SINGLY_LIST_H
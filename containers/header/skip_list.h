@@ -0,0 +1,196 @@
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <stddef.h>
+
+/* status codes */
+#define SKL_OK   0   // operation successful
+#define SKL_ERR -1   // operation failed
+
+/**
+ * opaque ordered skip list type
+ * keeps its elements sorted by a comparator, equal elements are kept in
+ * insertion order (it's an ordered multiset)
+ * every level link counts the elements it jumps over (span), which gives
+ * rank / select in logarithmic time
+ *
+ * a list created with `skl_create_concurrent` accepts `skl_insert`, lookups
+ * and cursors from any number of threads at once, lock-free; it doesn't
+ * support erase, clear, rank nor select
+ */
+typedef struct SkipList SkipList;
+
+/**
+ * comparison function used to order elements
+ * returns negative if a < b, 0 if equal, positive if a > b
+ */
+typedef int (*skl_cmp_fn)(const void *a, const void *b);
+
+/**
+ * cursor: a position in the ordered sequence, used for ordered iteration
+ * a cursor stays valid until the element it sits on is erased
+ */
+typedef struct SKLCursor {
+    const SkipList *list;   // list the cursor walks
+    struct SKLNode *node;   // current position (private, don't touch)
+} SKLCursor;
+
+/* constructor / destructor */
+
+/**
+ * creates a new (single-threaded) skip list
+ *
+ * @param elem_size size of each element in bytes
+ * @param cmp comparison function ordering the elements
+ * @return pointer to the newly created list, or NULL on failure
+ */
+SkipList *skl_create(size_t elem_size, skl_cmp_fn cmp);
+
+/**
+ * creates a new skip list for concurrent lock-free insertion and lookup
+ *
+ * @param elem_size size of each element in bytes
+ * @param cmp comparison function ordering the elements
+ * @return pointer to the newly created list, or NULL on failure
+ */
+SkipList *skl_create_concurrent(size_t elem_size, skl_cmp_fn cmp);
+
+/**
+ * frees all memory used by the list (no other thread may use it anymore)
+ *
+ * @param list pointer to the list to destroy
+ */
+void skl_destroy(SkipList *list);
+
+
+/* modifiers */
+
+/**
+ * inserts a copy of `elem` at its ordered position (after the equal ones), O(log n) expected
+ * thread-safe on a concurrent list
+ *
+ * @param list pointer to the list
+ * @param elem pointer to the element to insert
+ * @return SKL_OK on success, SKL_ERR on failure
+ */
+int skl_insert(SkipList *list, const void *elem);
+
+/**
+ * removes the first element equal to `key`, O(log n) expected
+ *
+ * @param list pointer to the list
+ * @param key pointer to the element to compare against
+ * @return SKL_OK on success, SKL_ERR if not found (or on a concurrent list)
+ */
+int skl_erase(SkipList *list, const void *key);
+
+/**
+ * clears the list contents (size becomes 0), does nothing on a concurrent list
+ *
+ * @param list pointer to the list
+ */
+void skl_clear(SkipList *list);
+
+
+/* lookup */
+
+/**
+ * returns the first element equal to `key`, O(log n) expected
+ *
+ * @param list pointer to the list
+ * @param key pointer to the element to compare against
+ * @return pointer to the element, or NULL if not found
+ */
+void *skl_find(const SkipList *list, const void *key);
+
+/**
+ * returns the first element not less than `key`, O(log n) expected
+ *
+ * @param list pointer to the list
+ * @param key pointer to the element to compare against
+ * @return pointer to the element, or NULL if every element is less than `key`
+ */
+void *skl_lower_bound(const SkipList *list, const void *key);
+
+/**
+ * returns the number of elements less than `key`, O(log n) expected
+ *
+ * @param list pointer to the list
+ * @param key pointer to the element to compare against
+ * @return the rank of `key`, or (size_t)-1 on failure (or on a concurrent list)
+ */
+size_t skl_rank(const SkipList *list, const void *key);
+
+/**
+ * returns the element at position `index` in sorted order, O(log n) expected
+ *
+ * @param list pointer to the list
+ * @param index 0-based position in sorted order
+ * @return pointer to the element, or NULL if out of bounds (or on a concurrent list)
+ */
+void *skl_select(const SkipList *list, size_t index);
+
+
+/* utilities */
+
+/**
+ * returns the number of elements in the list
+ *
+ * @param list pointer to the list
+ * @return number of elements
+ */
+size_t skl_size(const SkipList *list);
+
+/**
+ * checks if the list is empty
+ *
+ * @param list pointer to the list
+ * @return non-zero if empty, 0 otherwise
+ */
+int skl_is_empty(const SkipList *list);
+
+
+/* ordered iteration */
+
+/**
+ * returns a cursor on the smallest element (past the end if the list is empty)
+ *
+ * @param list pointer to the list
+ * @return the cursor
+ */
+SKLCursor skl_cursor_begin(const SkipList *list);
+
+/**
+ * returns a cursor on the first element not less than `key` (past the end if none)
+ *
+ * @param list pointer to the list
+ * @param key pointer to the element to compare against
+ * @return the cursor
+ */
+SKLCursor skl_cursor_lower_bound(const SkipList *list, const void *key);
+
+/**
+ * checks whether the cursor is past the last element
+ *
+ * @param cur pointer to the cursor
+ * @return non-zero if past the end or invalid, 0 otherwise
+ */
+int skl_cursor_is_end(const SKLCursor *cur);
+
+/**
+ * moves the cursor to the next element in sorted order, constant time O(1)
+ *
+ * @param cur pointer to the cursor
+ * @return SKL_OK on success, SKL_ERR if already past the end
+ */
+int skl_cursor_next(SKLCursor *cur);
+
+/**
+ * returns a pointer to the element under the cursor
+ *
+ * @param cur pointer to the cursor
+ * @return pointer to the element, or NULL past the end
+ */
+void *skl_cursor_get(const SKLCursor *cur);
+
+#endif // SKIP_LIST_H
@@ -0,0 +1,78 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stddef.h>
+
+/* status codes */
+#define TP_OK   0   // operation successful
+#define TP_ERR -1   // operation failed
+
+/**
+ * opaque fork-join thread pool
+ * every worker owns a work-stealing deque: spawned tasks are pushed on the
+ * spawner's deque, idle workers steal from the others (no global queue lock)
+ */
+typedef struct ThreadPool ThreadPool;
+
+/**
+ * opaque handle of a spawned task, consumed by `tp_sync`
+ */
+typedef struct TPTask TPTask;
+
+/**
+ * task body
+ *
+ * @param arg user argument given to `tp_spawn`
+ */
+typedef void (*tp_task_fn)(void *arg);
+
+/**
+ * creates a pool of `nworkers` workers
+ * the calling thread becomes worker 0 and `nworkers - 1` threads are started
+ * a thread may create several pools (even from inside a task) and use each
+ * of them independently
+ *
+ * @param nworkers total number of workers (including the caller), must be > 0
+ * @return pointer to the created pool, or NULL on failure
+ */
+ThreadPool *tp_create(size_t nworkers);
+
+/**
+ * stops the worker threads and frees the pool
+ * must be called by the creating thread, with every spawned task synced
+ *
+ * @param pool pointer to the pool
+ */
+void tp_destroy(ThreadPool *pool);
+
+/**
+ * spawns `fn(arg)` as a task that may run on any worker
+ * must be called from the creating thread or from inside a task
+ *
+ * @param pool pointer to the pool
+ * @param fn task body
+ * @param arg argument passed to `fn`
+ * @return handle to pass to `tp_sync`, or NULL on failure (nothing was spawned)
+ */
+TPTask *tp_spawn(ThreadPool *pool, tp_task_fn fn, void *arg);
+
+/**
+ * waits until `task` has finished, running other pending tasks meanwhile,
+ * then releases the handle
+ * must be called by the thread that spawned the task
+ *
+ * @param pool pointer to the pool
+ * @param task handle returned by `tp_spawn`
+ * @return TP_OK on success, TP_ERR on invalid input
+ */
+int tp_sync(ThreadPool *pool, TPTask *task);
+
+/**
+ * returns the number of workers (including the creating thread)
+ *
+ * @param pool pointer to the pool
+ * @return number of workers, or 0 if the pool is invalid
+ */
+size_t tp_num_workers(const ThreadPool *pool);
+
+#endif // THREAD_POOL_H
@@ -0,0 +1,121 @@
+#ifndef TIMING_WHEEL_H
+#define TIMING_WHEEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* status codes */
+#define TW_OK    0   // operation successful
+#define TW_ERR  -1   // operation failed
+
+/**
+ * opaque hierarchical timing wheel type, for large populations of timers
+ * that are mostly cancelled before they fire
+ *
+ * time is counted in ticks of `resolution` units since `start` (any clock
+ * the caller likes: ns, ms, simulation steps...); each level is a wheel of
+ * 256 slots, level L covering ticks in steps of 256^L
+ * a timer sits in the slot of the highest 8-bit digit where its expiry tick
+ * differs from the current tick, and drops to lower levels as the current
+ * tick catches up (each timer moves at most once per level); timers beyond
+ * the top level wait in an overflow list
+ *
+ * schedule and cancel are O(1); tw_advance skips the empty slots, its cost
+ * is the number of timers fired or cascaded plus the occupied slots visited
+ *
+ * timers fire at most one tick late, never early
+ */
+typedef struct TimingWheel TimingWheel;
+
+/**
+ * opaque handle to a scheduled timer, valid until it is cancelled or
+ * until its callback starts
+ */
+typedef struct TWTimer TWTimer;
+
+/**
+ * callback run by tw_advance for each expired timer
+ *
+ * @param elem pointer to the timer's payload (valid during the call)
+ * @param arg the argument given to tw_advance
+ * @note it may schedule or cancel other timers, but not call tw_advance
+ */
+typedef void (*tw_fire_fn)(void *elem, void *arg);
+
+/* constructor / destructor */
+
+/**
+ * creates a new timing wheel
+ *
+ * @param elem_size size of the payload of each timer (0 for none)
+ * @param start time the wheel starts at (tick 0)
+ * @param resolution length of a tick, in the caller's time unit (> 0)
+ * @param levels number of wheels, from 1 to 8 (covering 256^levels ticks
+ *        before the overflow list is used)
+ * @return pointer to the wheel, or NULL on failure
+ */
+TimingWheel *tw_create(size_t elem_size, uint64_t start, uint64_t resolution, size_t levels);
+
+/**
+ * destroys the wheel and every pending timer (no callback is run)
+ *
+ * @param tw pointer to the wheel
+ */
+void tw_destroy(TimingWheel *tw);
+
+
+/* modifiers */
+
+/**
+ * schedules a timer with a copy of `elem`, in O(1)
+ *
+ * @param tw pointer to the wheel
+ * @param expires time at which the timer fires (a time already reached fires at the next tick)
+ * @param elem pointer to the payload (ignored if elem_size is 0)
+ * @return handle to the timer, or NULL on failure
+ */
+TWTimer *tw_schedule(TimingWheel *tw, uint64_t expires, const void *elem);
+
+/**
+ * cancels a pending timer, in O(1), its handle becomes invalid
+ *
+ * @param tw pointer to the wheel
+ * @param timer handle returned by tw_schedule
+ * @return TW_OK on success, TW_ERR on failure
+ */
+int tw_cancel(TimingWheel *tw, TWTimer *timer);
+
+/**
+ * moves the wheel forward to `now`, running `fire` on every timer expired
+ * by then, slot by slot (the timers of a same tick fire in no given order)
+ *
+ * @param tw pointer to the wheel
+ * @param now current time (earlier than the last call: nothing happens)
+ * @param fire callback run on each expired timer (may be NULL to drop them)
+ * @param arg argument passed to the callback
+ * @return the number of timers fired
+ */
+size_t tw_advance(TimingWheel *tw, uint64_t now, tw_fire_fn fire, void *arg);
+
+
+/* lookup */
+
+/**
+ * returns a pointer to the payload of a pending timer
+ *
+ * @param timer handle returned by tw_schedule
+ * @return pointer to the payload, or NULL if `timer` is NULL
+ */
+void *tw_value(const TWTimer *timer);
+
+/**
+ * returns the number of pending timers
+ */
+size_t tw_size(const TimingWheel *tw);
+
+/**
+ * returns non-zero if no timer is pending (or the wheel is invalid)
+ */
+int tw_is_empty(const TimingWheel *tw);
+
+#endif // TIMING_WHEEL_H
@@ -0,0 +1,102 @@
+#ifndef TOPK_H
+#define TOPK_H
+
+#include <stddef.h>
+
+/* status codes */
+#define TOPK_OK        0   // operation successful (offer: the element was kept)
+#define TOPK_ERR      -1   // operation failed
+#define TOPK_REJECTED  1   // offer: the element doesn't rank among the K kept
+
+/**
+ * opaque bounded top-K type: keeps the K largest elements seen in a stream
+ * in exactly K slots, allocated once
+ *
+ * the kept elements form a binary min-heap, so the smallest of them (the
+ * threshold to beat) is at the root: once K elements are kept, an offer
+ * below the threshold costs one comparison and no copy, and one above it
+ * overwrites the root and sifts it down
+ *
+ * to keep the K smallest, pass a reversed comparator
+ */
+typedef struct TopK TopK;
+
+/**
+ * comparison function, in ascending order
+ * returns negative if a < b, 0 if equal, positive if a > b
+ */
+typedef int (*topk_cmp_fn)(const void *a, const void *b);
+
+/* constructor / destructor */
+
+/**
+ * creates a new top-K container
+ *
+ * @param k number of elements to keep (> 0)
+ * @param elem_size size of each element
+ * @param cmp comparison function
+ * @return pointer to the container, or NULL on failure
+ */
+TopK *topk_create(size_t k, size_t elem_size, topk_cmp_fn cmp);
+
+/**
+ * destroys the container and releases memory
+ *
+ * @param topk pointer to the container
+ */
+void topk_destroy(TopK *topk);
+
+
+/* modifiers */
+
+/**
+ * offers a copy of `elem` to the container, in O(1) when rejected and
+ * O(log K) when kept
+ * ties with the threshold are rejected (the elements kept first stay)
+ *
+ * @param topk pointer to the container
+ * @param elem pointer to the element
+ * @return TOPK_OK if kept, TOPK_REJECTED if not, TOPK_ERR on failure
+ */
+int topk_offer(TopK *topk, const void *elem);
+
+/**
+ * forgets every element (the K slots are kept)
+ *
+ * @param topk pointer to the container
+ */
+void topk_clear(TopK *topk);
+
+
+/* lookup */
+
+/**
+ * returns a pointer to the smallest element kept, the one a new element
+ * must beat once the container is full
+ *
+ * @param topk pointer to the container
+ * @return pointer to the element, or NULL if empty
+ */
+const void *topk_threshold(const TopK *topk);
+
+/**
+ * copies the elements kept to `dst`, largest first, in O(K log K)
+ * the container itself is left untouched
+ *
+ * @param topk pointer to the container
+ * @param dst buffer of at least topk_size elements
+ * @return the number of elements copied
+ */
+size_t topk_sorted(const TopK *topk, void *dst);
+
+/**
+ * returns the number of elements kept (at most K)
+ */
+size_t topk_size(const TopK *topk);
+
+/**
+ * returns K
+ */
+size_t topk_capacity(const TopK *topk);
+
+#endif // TOPK_H
@@ -0,0 +1,162 @@
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include <stddef.h>
+
+/* status codes */
+#define UL_OK   0   // operation successful
+#define UL_ERR -1   // operation failed
+
+/**
+ * opaque unrolled linked list type
+ * each node holds a small array of elements, so the links are paid once per
+ * node and walks skip whole nodes
+ * neighbouring nodes are kept more than half full on average
+ */
+typedef struct UnrolledList UnrolledList;
+
+/* constructor / destructor */
+
+/**
+ * creates a new unrolled list with elements of size `elem_size`
+ *
+ * @param elem_size size of each element in bytes
+ * @return pointer to the newly created list, or NULL on failure
+ */
+UnrolledList *ul_create(size_t elem_size);
+
+/**
+ * frees all memory used by the list
+ *
+ * @param list pointer to the list to destroy
+ */
+void ul_destroy(UnrolledList *list);
+
+
+/* insertion */
+
+/**
+ * inserts an element at the front of the list
+ *
+ * @param list pointer to the list
+ * @param src pointer to the element to insert
+ * @return UL_OK on success, UL_ERR on failure
+ */
+int ul_push_front(UnrolledList *list, const void *src);
+
+/**
+ * inserts an element at the back of the list (amortized constant time)
+ *
+ * @param list pointer to the list
+ * @param src pointer to the element to insert
+ * @return UL_OK on success, UL_ERR on failure
+ */
+int ul_push_back(UnrolledList *list, const void *src);
+
+/**
+ * inserts an element at the given index (0-indexed)
+ * a full node is split in two halves
+ *
+ * @param list pointer to the list
+ * @param index position at which to insert, in the range [0, size]
+ * @param src pointer to the element to insert
+ * @return UL_OK on success, UL_ERR on failure
+ */
+int ul_insert_at(UnrolledList *list, size_t index, const void *src);
+
+
+/* deletion */
+
+/**
+ * removes the front element
+ *
+ * @param list pointer to the list
+ * @return UL_OK on success, UL_ERR on failure (or if the list is empty)
+ */
+int ul_pop_front(UnrolledList *list);
+
+/**
+ * removes the last element
+ *
+ * @param list pointer to the list
+ * @return UL_OK on success, UL_ERR on failure (or if the list is empty)
+ */
+int ul_pop_back(UnrolledList *list);
+
+/**
+ * removes the element at the given index (0-indexed)
+ * a node falling under half full is merged with a neighbour when they fit in one node
+ *
+ * @param list pointer to the list
+ * @param index position of the element to remove
+ * @return UL_OK on success, UL_ERR on failure
+ */
+int ul_remove_at(UnrolledList *list, size_t index);
+
+
+/* access */
+
+/**
+ * returns a pointer to the front element
+ *
+ * @param list pointer to the list
+ * @return pointer to the front element, or NULL if the list is empty
+ */
+void *ul_front(const UnrolledList *list);
+
+/**
+ * returns a pointer to the last element
+ *
+ * @param list pointer to the list
+ * @return pointer to the last element, or NULL if the list is empty
+ */
+void *ul_back(const UnrolledList *list);
+
+/**
+ * returns a pointer to the element at the given index (0-indexed)
+ * the walk skips whole nodes, and sequential indices reuse the last node reached
+ *
+ * @param list pointer to the list
+ * @param index position of the element to retrieve
+ * @return pointer to the element, or NULL if out of bounds
+ * @note the pointer is invalidated by any insertion or removal
+ * @note remembering the last node reached writes to the list: concurrent
+ *       calls on one list need the same locking as modifiers
+ */
+void *ul_get(UnrolledList *list, size_t index);
+
+
+/* utilities */
+
+/**
+ * returns the number of elements in the list
+ *
+ * @param list pointer to the list
+ * @return number of elements
+ */
+size_t ul_size(const UnrolledList *list);
+
+/**
+ * checks if the list is empty
+ *
+ * @param list pointer to the list
+ * @return non-zero if empty, 0 otherwise
+ */
+int ul_is_empty(const UnrolledList *list);
+
+/**
+ * returns the maximum number of elements a node holds
+ *
+ * @param list pointer to the list
+ * @return elements per node, or 0 if the list is invalid
+ */
+size_t ul_node_capacity(const UnrolledList *list);
+
+/**
+ * clears the list contents (size becomes 0)
+ *
+ * @param list pointer to the list
+ */
+void ul_clear(UnrolledList *list);
+
+#endif // UNROLLED_LIST_H
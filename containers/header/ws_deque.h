@@ -0,0 +1,69 @@
+#ifndef WS_DEQUE_H
+#define WS_DEQUE_H
+
+#include <stddef.h>
+
+/* status codes */
+#define WSD_OK   0   // operation successful
+#define WSD_ERR -1   // operation failed
+
+/**
+ * opaque lock-free work-stealing deque (Chase-Lev)
+ * holds pointers: one owner thread pushes and pops at the bottom (LIFO),
+ * any number of other threads steal from the top (FIFO)
+ */
+typedef struct WSDeque WSDeque;
+
+/**
+ * creates a new work-stealing deque
+ *
+ * @param initial_capacity number of slots to start with (rounded up to a power of two)
+ * @return pointer to the created deque, or NULL on failure
+ */
+WSDeque *wsd_create(size_t initial_capacity);
+
+/**
+ * destroys the deque, no thread may be using it anymore
+ *
+ * @param dq pointer to the deque
+ * @note items still stored in the deque are not freed
+ */
+void wsd_destroy(WSDeque *dq);
+
+/**
+ * pushes an item at the bottom, the buffer grows when full
+ * must only be called by the owner thread
+ *
+ * @param dq pointer to the deque
+ * @param item pointer to store (must not be NULL)
+ * @return WSD_OK on success, WSD_ERR on failure
+ */
+int wsd_push(WSDeque *dq, void *item);
+
+/**
+ * pops the most recently pushed item from the bottom
+ * must only be called by the owner thread
+ *
+ * @param dq pointer to the deque
+ * @return the item, or NULL if the deque is empty (or the last item was stolen)
+ */
+void *wsd_pop(WSDeque *dq);
+
+/**
+ * steals the oldest item from the top, safe to call from any thread
+ *
+ * @param dq pointer to the deque
+ * @return the item, or NULL if the deque is empty or the race was lost
+ */
+void *wsd_steal(WSDeque *dq);
+
+/**
+ * returns the number of items in the deque
+ * the value is a snapshot when other threads are stealing concurrently
+ *
+ * @param dq pointer to the deque
+ * @return number of items, or 0 if the deque is invalid
+ */
+size_t wsd_size(const WSDeque *dq);
+
+#endif // WS_DEQUE_H
@@ -0,0 +1,334 @@
+/* implemented interface */
+# include "deque.h"
+
+/* implementation dependencies */
+# include <stdlib.h>
+# include <string.h>
+# include <stdint.h>
+
+# define BLOCK_BYTES 512        // target size of one block
+# define MIN_BLOCK_ELEMS 16     // lower bound of elements per block (large elements)
+# define INITIAL_MAP_CAPACITY 8 // number of block slots in a fresh map
+
+/*
+** private data
+**
+** the map is a circular array of block pointers, the blocks in use are
+** map[map_head], map[map_head + 1], ... (mod map_cap)
+** the element at index i lives at logical position (front + i), that is,
+** in block (front + i) / block_elems at slot (front + i) % block_elems
+*/
+typedef struct Deque {
+    void **map;          // circular array of block pointers
+    size_t map_cap;      // number of slots in the map
+    size_t map_head;     // map slot holding the first block in use
+    size_t nblocks;      // number of blocks in use
+    size_t front;        // slot of the front element inside the first block
+    size_t size;         // number of elements
+    size_t elem_size;    // size of each element in bytes
+    size_t block_elems;  // number of elements per block
+    void *spare;         // one released block kept around to avoid alloc/free thrashing
+} Deque;
+
+
+/* helpers */
+
+/* returns the map slot of the `i`-th block in use */
+static inline size_t helper_map_slot(const Deque *dq, size_t i) {
+    return ((dq->map_head + i) % dq->map_cap);
+}
+
+/* returns a pointer to the element at logical position `pos` (front included) */
+static inline void *helper_at(const Deque *dq, size_t pos) {
+    char *block = dq->map[helper_map_slot(dq, pos / dq->block_elems)];
+
+    return (block + (pos % dq->block_elems) * dq->elem_size);
+}
+
+/* returns a fresh (or the spare) block, NULL to indicate failure */
+static void *helper_new_block(Deque *dq) {
+    if (dq->spare != NULL) {
+        void *block = dq->spare;
+        dq->spare = NULL;
+        return (block);
+    }
+
+    return (malloc(dq->block_elems * dq->elem_size));
+}
+
+/* keeps the block as spare if there is none, releases it otherwise */
+static void helper_release_block(Deque *dq, void *block) {
+    if (dq->spare == NULL) {
+        dq->spare = block;
+        return ;
+    }
+
+    free(block);
+}
+
+/*
+** makes room for one more block in the map
+** block pointers are copied in order into a map twice as big, the blocks
+** themselves (and thus the elements) never move
+*/
+static int helper_grow_map(Deque *dq) {
+    if (dq->nblocks < dq->map_cap) {
+        return (DQ_OK);
+    }
+
+    if (dq->map_cap > SIZE_MAX / 2 / sizeof(void *)) {
+        return (DQ_ERR);
+    }
+
+    size_t new_cap = dq->map_cap * 2;
+    void **new_map = malloc(new_cap * sizeof(void *));
+
+    if (new_map == NULL) {
+        return (DQ_ERR);
+    }
+
+    for (size_t i = 0; i < dq->nblocks; ++i) {
+        new_map[i] = dq->map[helper_map_slot(dq, i)];
+    }
+
+    free(dq->map);
+    dq->map = new_map;
+    dq->map_cap = new_cap;
+    dq->map_head = 0;
+
+    return (DQ_OK);
+}
+
+/* releases every block in use, the deque must be logically empty */
+static void helper_release_all(Deque *dq) {
+    for (size_t i = 0; i < dq->nblocks; ++i) {
+        helper_release_block(dq, dq->map[helper_map_slot(dq, i)]);
+    }
+
+    dq->nblocks = 0;
+    dq->map_head = 0;
+    dq->front = 0;
+}
+
+
+/* constructor / destructor */
+
+/* elem_size must be greater than 0 */
+/* return NULL to indicate construction failure */
+Deque *dq_create(size_t elem_size) {
+    if (elem_size == 0 || elem_size > SIZE_MAX / MIN_BLOCK_ELEMS) {
+        return (NULL);
+    }
+
+    Deque *dq = malloc(sizeof(Deque));
+
+    if (dq == NULL) {
+        return (NULL);
+    }
+
+    dq->map = malloc(INITIAL_MAP_CAPACITY * sizeof(void *));
+
+    if (dq->map == NULL) {
+        free(dq);
+        return (NULL);
+    }
+
+    dq->block_elems = BLOCK_BYTES / elem_size;
+    if (dq->block_elems < MIN_BLOCK_ELEMS) {
+        dq->block_elems = MIN_BLOCK_ELEMS;
+    }
+
+    dq->map_cap = INITIAL_MAP_CAPACITY;
+    dq->map_head = 0;
+    dq->nblocks = 0;
+    dq->front = 0;
+    dq->size = 0;
+    dq->elem_size = elem_size;
+    dq->spare = NULL;
+
+    return (dq);
+}
+
+void dq_destroy(Deque *dq) {
+    if (dq == NULL) {
+        return ;
+    }
+
+    dq_clear(dq);
+
+    free(dq->spare);
+    free(dq->map);
+    free(dq);
+}
+
+
+/* insertion */
+
+int dq_push_front(Deque *dq, const void *src) {
+    if (dq == NULL || src == NULL) {
+        return (DQ_ERR);
+    }
+
+    /* first block is full on the left side (or there is none), add a block before it */
+    if (dq->front == 0) {
+        if (helper_grow_map(dq) == DQ_ERR) {
+            return (DQ_ERR);
+        }
+
+        void *block = helper_new_block(dq);
+
+        if (block == NULL) {
+            return (DQ_ERR);
+        }
+
+        dq->map_head = (dq->map_head + dq->map_cap - 1) % dq->map_cap;
+        dq->map[dq->map_head] = block;
+        dq->nblocks++;
+        dq->front = dq->block_elems;
+    }
+
+    dq->front--;
+    memcpy(helper_at(dq, dq->front), src, dq->elem_size);
+    dq->size++;
+
+    return (DQ_OK);
+}
+
+int dq_push_back(Deque *dq, const void *src) {
+    if (dq == NULL || src == NULL) {
+        return (DQ_ERR);
+    }
+
+    size_t pos = dq->front + dq->size;
+
+    /* last block is full (or there is none), add a block after it */
+    if (pos == dq->nblocks * dq->block_elems) {
+        if (helper_grow_map(dq) == DQ_ERR) {
+            return (DQ_ERR);
+        }
+
+        void *block = helper_new_block(dq);
+
+        if (block == NULL) {
+            return (DQ_ERR);
+        }
+
+        dq->map[helper_map_slot(dq, dq->nblocks)] = block;
+        dq->nblocks++;
+    }
+
+    memcpy(helper_at(dq, pos), src, dq->elem_size);
+    dq->size++;
+
+    return (DQ_OK);
+}
+
+
+/* deletion */
+
+int dq_pop_front(Deque *dq) {
+    if (dq == NULL || dq->size == 0) {
+        return (DQ_ERR);
+    }
+
+    dq->front++;
+    dq->size--;
+
+    if (dq->size == 0) {
+        helper_release_all(dq);
+        return (DQ_OK);
+    }
+
+    /* first block has no element left */
+    if (dq->front == dq->block_elems) {
+        helper_release_block(dq, dq->map[dq->map_head]);
+        dq->map_head = helper_map_slot(dq, 1);
+        dq->nblocks--;
+        dq->front = 0;
+    }
+
+    return (DQ_OK);
+}
+
+int dq_pop_back(Deque *dq) {
+    if (dq == NULL || dq->size == 0) {
+        return (DQ_ERR);
+    }
+
+    dq->size--;
+
+    if (dq->size == 0) {
+        helper_release_all(dq);
+        return (DQ_OK);
+    }
+
+    /* last block has no element left */
+    if (dq->front + dq->size == (dq->nblocks - 1) * dq->block_elems) {
+        helper_release_block(dq, dq->map[helper_map_slot(dq, dq->nblocks - 1)]);
+        dq->nblocks--;
+    }
+
+    return (DQ_OK);
+}
+
+
+/* access */
+
+void *dq_front(const Deque *dq) {
+    if (dq == NULL || dq->size == 0) {
+        return (NULL);
+    }
+
+    return (helper_at(dq, dq->front));
+}
+
+void *dq_back(const Deque *dq) {
+    if (dq == NULL || dq->size == 0) {
+        return (NULL);
+    }
+
+    return (helper_at(dq, dq->front + dq->size - 1));
+}
+
+void *dq_get(const Deque *dq, size_t index) {
+    if (dq == NULL || index >= dq->size) {
+        return (NULL);
+    }
+
+    return (helper_at(dq, dq->front + index));
+}
+
+int dq_set(Deque *dq, size_t index, const void *src) {
+    if (dq == NULL || src == NULL || index >= dq->size) {
+        return (DQ_ERR);
+    }
+
+    memcpy(helper_at(dq, dq->front + index), src, dq->elem_size);
+
+    return (DQ_OK);
+}
+
+
+/* utilities */
+
+size_t dq_size(const Deque *dq) {
+    if (dq == NULL) {
+        return (0);
+    }
+
+    return (dq->size);
+}
+
+int dq_is_empty(const Deque *dq) {
+    return (dq == NULL || dq->size == 0);
+}
+
+/* clears the deque, after this call, dq->size is 0 */
+void dq_clear(Deque *dq) {
+    if (dq == NULL) {
+        return ;
+    }
+
+    helper_release_all(dq);
+    dq->size = 0;
+}
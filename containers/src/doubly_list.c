@@ -2,13 +2,21 @@
 # include "doubly_list.h"
 
 // implementation dependencies
+# include "pool_allocator.h"
 # include <stdlib.h>
 # include <string.h>
-  
+# include <stdalign.h>
+# include <stddef.h>
+# include <stdint.h>
+
+# define SORT_MAX_RUNS 64   // runs of 2^0 .. 2^63 nodes, enough for any size_t count
+
+/* the element is stored inline, right after the links (one allocation per node) */
+/* dummy head and tail nodes are allocated without element storage */
 typedef struct DLNode {
-    void            *data;
     struct DLNode   *prev;
     struct DLNode   *next;
+    alignas(max_align_t) unsigned char data[];
 }DLNode;
 
 /* opaque doubly list type */
@@ -17,6 +25,11 @@ typedef struct DoublyList {
     size_t elem_size;
     DLNode *head; // dummy node (first node is pointed to by head->next)
     DLNode *tail; // dummy node (last node is pointed to by tail->prev)
+    PoolAllocator *pool; // node storage (slabs + free list), dummies excluded
+    DLNode *finger; // last node reached by index, NULL when unknown
+    size_t finger_index; // index of `finger`
+    PoolAllocator *old_pool; // pool being emptied by a compaction in progress, NULL otherwise
+    DLNode *compact_next; // next node the compaction visits
 }DoublyList;
 
 
@@ -30,7 +43,7 @@ static DLNode *helper_new_node(DoublyList *list, DLNode *prev, DLNode *next, con
         return (NULL);
     }
 
-    DLNode *new_node = malloc(sizeof(DLNode));
+    DLNode *new_node = pool_alloc(list->pool);
 
     if (new_node == NULL) {
         return (NULL);
@@ -38,13 +51,6 @@ static DLNode *helper_new_node(DoublyList *list, DLNode *prev, DLNode *next, con
  
     new_node->prev = prev;
     new_node->next = next;
-    new_node->data = malloc(list->elem_size);
-
-    if (new_node->data == NULL) {
-        free(new_node);
-        return (NULL);
-    }
-
     memcpy(new_node->data, src, list->elem_size);
 
     return (new_node);
@@ -55,7 +61,6 @@ static DLNode *helper_delete_node(DoublyList *list, DLNode *node) {
         return (NULL); 
     }
 
-    void *data = node->data;
     DLNode *next = node->next;
     DLNode *prev = node->prev;
 
@@ -68,18 +73,23 @@ static DLNode *helper_delete_node(DoublyList *list, DLNode *node) {
     prev->next = next;
     next->prev = prev;
 
-    // releasing acquired memory
-    free(node);
+    if (list->compact_next == node) {
+        list->compact_next = next;
+    }
 
-    if (data != NULL) {
-        free(data);
+    // giving the node (element included) back to the pool it comes from
+    if (list->old_pool != NULL && !pool_owns(list->pool, node)) {
+        pool_free(list->old_pool, node);
+    } else {
+        pool_free(list->pool, node);
     }
 
     return (next);
 }
 
 /* returns a pointer to the node at the index `index` */
-static DLNode *helper_get_node(const DoublyList *list, size_t index) {
+/* the walk starts from whichever of head, tail or finger is closest (sequential access is O(1)) */
+static DLNode *helper_get_node(DoublyList *list, size_t index) {
     if (list == NULL || list->head == NULL) {
         return (NULL);
     }
@@ -88,24 +98,149 @@ static DLNode *helper_get_node(const DoublyList *list, size_t index) {
         return (NULL);
     }
 
-    DLNode *curr;
-    if (index < list->size / 2) {
-        curr = list->head->next;
-        while (index--) {
-            curr = curr->next;
+    /* start from the head */
+    DLNode *curr = list->head->next;
+    size_t i = 0;
+    size_t distance = index;
+
+    /* or from the tail */
+    if (list->size - 1 - index < distance) {
+        curr = list->tail->prev;
+        i = list->size - 1;
+        distance = list->size - 1 - index;
+    }
+
+    /* or from the finger */
+    if (list->finger != NULL) {
+        size_t fi = list->finger_index;
+        size_t finger_distance = (fi > index) ? fi - index : index - fi;
+
+        if (finger_distance < distance) {
+            curr = list->finger;
+            i = fi;
         }
+    }
 
-        return (curr);
+    while (i < index) {
+        curr = curr->next;
+        i++;
     }
 
-    curr = list->tail->prev;
-    for (size_t i = list->size - 1; i > index; --i) {
+    while (i > index) {
         curr = curr->prev;
+        i--;
     }
 
+    list->finger = curr;
+    list->finger_index = index;
+
     return (curr);
 }
 
+/* keeps the finger on the same node when an element is inserted at `index` */
+static void helper_finger_inserted(DoublyList *list, size_t index) {
+    if (list->finger != NULL && index <= list->finger_index) {
+        list->finger_index++;
+    }
+}
+
+/* keeps the finger usable when the element `node` at `index` is about to be removed */
+static void helper_finger_removed(DoublyList *list, size_t index, DLNode *node) {
+    if (list->finger == NULL) {
+        return ;
+    }
+
+    if (list->finger == node) {
+        /* step back onto the previous node, so removal loops keep their O(1) walk */
+        list->finger = (node->prev == list->head) ? NULL : node->prev;
+        list->finger_index = index - 1;
+    } else if (index < list->finger_index) {
+        list->finger_index--;
+    }
+}
+
+/* stops a compaction in progress: the nodes already moved stay where they are */
+/* and the fresh pool joins the old one, in O(1) */
+static void helper_compact_cancel(DoublyList *list) {
+    if (list->old_pool == NULL) {
+        return ;
+    }
+
+    pool_absorb(list->old_pool, list->pool);
+    pool_destroy(list->pool);
+    list->pool = list->old_pool;
+    list->old_pool = NULL;
+    list->compact_next = NULL;
+}
+
+/* frees every node of the list, in bulk unless the pool is shared with another list */
+static void helper_release_nodes(DoublyList *list) {
+    helper_compact_cancel(list);
+
+    if (!pool_is_shared(list->pool)) {
+        pool_clear(list->pool);
+        return ;
+    }
+
+    DLNode *node = list->head->next;
+
+    while (node != list->tail) {
+        DLNode *next = node->next;
+        pool_free(list->pool, node);
+        node = next;
+    }
+}
+
+/* joins the pools of `dst` and `src` in O(1), so their nodes can be relinked across them */
+/* (the two lists have the same element size, hence the same block size) */
+static void helper_share_pool(DoublyList *dst, DoublyList *src) {
+    helper_compact_cancel(dst);
+    helper_compact_cancel(src);
+
+    if (dst->pool != src->pool) {
+        pool_absorb(dst->pool, src->pool);
+    }
+}
+
+/* relinks the `count` nodes [first, end) of `src` right before `pos` in `dst` */
+static void helper_move_range(DoublyList *dst, DLNode *pos, DoublyList *src, DLNode *first, DLNode *end, size_t count) {
+    DLNode *last = end->prev;
+
+    /* unlink the range */
+    first->prev->next = end;
+    end->prev = first->prev;
+
+    /* link it back before pos */
+    first->prev = pos->prev;
+    last->next = pos;
+    pos->prev->next = first;
+    pos->prev = last;
+
+    src->size -= count;
+    dst->size += count;
+}
+
+/* stable merge of two NULL-terminated runs linked through `next` (prev is left stale) */
+static DLNode *helper_merge_runs(DLNode *a, DLNode *b, dl_cmp_fn cmp) {
+    DLNode *merged = NULL;
+    DLNode **link = &merged;
+
+    while (a != NULL && b != NULL) {
+        /* on ties, the node from the earlier run `a` goes first */
+        if (cmp(b->data, a->data) < 0) {
+            *link = b;
+            b = b->next;
+        } else {
+            *link = a;
+            a = a->next;
+        }
+        link = &(*link)->next;
+    }
+
+    *link = (a != NULL) ? a : b;
+    return (merged);
+}
+
 
 /* constructor / destructor */
 DoublyList *dl_create(size_t elem_size) {
@@ -129,6 +264,14 @@ DoublyList *dl_create(size_t elem_size) {
         return (NULL);
     }
 
+    dl->pool = pool_create(sizeof(DLNode) + elem_size);
+    if (dl->pool == NULL) {
+        free(dl->tail);
+        free(dl->head);
+        free(dl);
+        return (NULL);
+    }
+
     // links initialization
     dl->head->prev = NULL;
     dl->tail->next = NULL;
@@ -138,13 +281,57 @@ DoublyList *dl_create(size_t elem_size) {
     // init size
     dl->elem_size = elem_size;
     dl->size = 0;
+    dl->finger = NULL;
+    dl->finger_index = 0;
+    dl->old_pool = NULL;
+    dl->compact_next = NULL;
 
     return (dl);
 }
 
+/* builds a list holding a copy of the `count` elements of `src`, in order */
+/* every node is carved from one reserved slab, in array order */
+DoublyList *dl_from_array(size_t elem_size, const void *src, size_t count) {
+    if (src == NULL && count > 0) {
+        return (NULL);
+    }
+
+    DoublyList *list = dl_create(elem_size);
+
+    if (list == NULL || count == 0) {
+        return (list);
+    }
+
+    if (pool_reserve(list->pool, count) == POOL_ERR) {
+        dl_destroy(list);
+        return (NULL);
+    }
+
+    const unsigned char *bytes = src;
+    DLNode *prev = list->head;
+
+    for (size_t i = 0; i < count; ++i) {
+        DLNode *node = pool_alloc(list->pool); // can't fail, the blocks are reserved
+        memcpy(node->data, bytes + i * elem_size, elem_size);
+        node->prev = prev;
+        prev->next = node;
+        prev = node;
+    }
+
+    prev->next = list->tail;
+    list->tail->prev = prev;
+    list->size = count;
+    return (list);
+}
+
 void dl_destroy(DoublyList *list) {
-    /* clear list */
-    dl_clear(list);
+    if (list == NULL) {
+        return ;
+    }
+
+    /* reclaim every node at once (only this list's nodes if the pool is shared) */
+    helper_release_nodes(list);
+    pool_destroy(list->pool);
 
     free(list->head);
     free(list->tail);
@@ -173,6 +360,7 @@ int dl_push_front(DoublyList *list, const void *src) {
 
     old_head_next->prev = new_node;
     list->head->next = new_node;
+    helper_finger_inserted(list, 0);
     list->size++;
     return (DL_OK);
 }
@@ -225,7 +413,8 @@ int dl_insert_at(DoublyList *list, size_t index, const void *src) {
 
     old_node->prev->next = new_node;
     old_node->prev = new_node;
-    
+
+    helper_finger_inserted(list, index);
     list->size++;
     return (DL_OK);
 }
@@ -241,6 +430,8 @@ int dl_pop_front(DoublyList *list) {
         return (DL_OK);
     }
 
+    helper_finger_removed(list, 0, list->head->next);
+
     if (helper_delete_node(list, list->head->next) == NULL) {
         return (DL_ERR);
     }
@@ -258,6 +449,8 @@ int dl_pop_back(DoublyList *list) {
         return (DL_OK);
     }
 
+    helper_finger_removed(list, list->size - 1, list->tail->prev);
+
     if (helper_delete_node(list, list->tail->prev) == NULL) {
         return (DL_ERR);
     }
@@ -281,6 +474,12 @@ int dl_remove_at(DoublyList *list, size_t index) {
 
     DLNode *node = helper_get_node(list, index);
 
+    if (node == NULL) {
+        return (DL_ERR);
+    }
+
+    helper_finger_removed(list, index, node);
+
     if (helper_delete_node(list, node) == NULL) {
         return (DL_ERR);
     }
@@ -291,7 +490,7 @@ int dl_remove_at(DoublyList *list, size_t index) {
 
 /* access */
 void *dl_front(const DoublyList *list) {
-    if (list == NULL || list->head == NULL || list->head->next == NULL) {
+    if (list == NULL || list->head == NULL || list->head->next == NULL || list->size == 0) {
         return (NULL);
     }
 
@@ -299,14 +498,14 @@ void *dl_front(const DoublyList *list) {
 }
 
 void *dl_back(const DoublyList *list) {
-    if (list == NULL || list->tail == NULL || list->tail->prev == NULL) {
+    if (list == NULL || list->tail == NULL || list->tail->prev == NULL || list->size == 0) {
         return (NULL);
     }
 
     return (list->tail->prev->data);
 }
 
-void *dl_get(const DoublyList *list, size_t index) {
+void *dl_get(DoublyList *list, size_t index) {
     DLNode *node = helper_get_node(list, index);
 
     if (node == NULL) {
@@ -330,19 +529,388 @@ int dl_is_empty(const DoublyList *list) {
     return (list == NULL || list->size == 0);
 }
 
+/* copies at most `capacity` elements, in order, with one walk */
+size_t dl_to_array(const DoublyList *list, void *dst, size_t capacity) {
+    if (list == NULL || list->head == NULL || dst == NULL) {
+        return (0);
+    }
+
+    unsigned char *bytes = dst;
+    size_t count = 0;
+
+    for (DLNode *node = list->head->next; node != list->tail && count < capacity; node = node->next) {
+        memcpy(bytes + count * list->elem_size, node->data, list->elem_size);
+        count++;
+    }
+
+    return (count);
+}
+
 /* clears the list, after this call, the list->size is 0 */
 void dl_clear(DoublyList *list) {
     if (list == NULL || list->head == NULL) {
         return ;
     }
 
-    DLNode *curr = list->head->next;
+    /* reclaims all DLNode blocks in bulk (no per-node walk, unless the pool is shared) */
+    helper_release_nodes(list);
+
+    list->head->next = list->tail;
+    list->tail->prev = list->head;
+    list->finger = NULL;
+    list->size = 0;
+}
+
+
+
+/* cursor */
+
+DLCursor dl_cursor_begin(DoublyList *list) {
+    DLCursor cur = { NULL, NULL };
 
-    /* deletes all DLNode blocks (freeing memory & deleting) */
-    while (curr != list->tail) {
-        curr = helper_delete_node(list, curr); // returns the next node
+    if (list == NULL || list->head == NULL) {
+        return (cur);
     }
 
-    list->size = 0;
+    cur.list = list;
+    cur.node = list->head->next; // the tail dummy when empty
+
+    return (cur);
+}
+
+DLCursor dl_cursor_last(DoublyList *list) {
+    DLCursor cur = { NULL, NULL };
+
+    if (list == NULL || list->tail == NULL) {
+        return (cur);
+    }
+
+    cur.list = list;
+    cur.node = list->tail->prev; // the head dummy when empty
+
+    return (cur);
+}
+
+/* the two dummies are the end positions (before first / after last) */
+int dl_cursor_is_end(const DLCursor *cur) {
+    return (cur == NULL || cur->list == NULL || cur->node == NULL
+        || cur->node == cur->list->head || cur->node == cur->list->tail);
+}
+
+int dl_cursor_next(DLCursor *cur) {
+    if (cur == NULL || cur->list == NULL || cur->node == NULL || cur->node == cur->list->tail) {
+        return (DL_ERR);
+    }
+
+    cur->node = cur->node->next;
+    return (DL_OK);
+}
+
+int dl_cursor_prev(DLCursor *cur) {
+    if (cur == NULL || cur->list == NULL || cur->node == NULL || cur->node == cur->list->head) {
+        return (DL_ERR);
+    }
+
+    cur->node = cur->node->prev;
+    return (DL_OK);
 }
 
+void *dl_cursor_get(const DLCursor *cur) {
+    if (dl_cursor_is_end(cur)) {
+        return (NULL);
+    }
+
+    return (cur->node->data);
+}
+
+int dl_cursor_insert_before(DLCursor *cur, const void *src) {
+    if (cur == NULL || cur->list == NULL || cur->node == NULL || src == NULL
+        || cur->node == cur->list->head) {
+        return (DL_ERR);
+    }
+
+    DLNode *next = cur->node;
+    DLNode *new_node = helper_new_node(cur->list, next->prev, next, src);
+
+    if (new_node == NULL) {
+        return (DL_ERR);
+    }
+
+    next->prev->next = new_node;
+    next->prev = new_node;
+    cur->list->finger = NULL; // cursors don't track indices
+    cur->list->size++;
+    return (DL_OK);
+}
+
+int dl_cursor_insert_after(DLCursor *cur, const void *src) {
+    if (cur == NULL || cur->list == NULL || cur->node == NULL || src == NULL
+        || cur->node == cur->list->tail) {
+        return (DL_ERR);
+    }
+
+    DLNode *prev = cur->node;
+    DLNode *new_node = helper_new_node(cur->list, prev, prev->next, src);
+
+    if (new_node == NULL) {
+        return (DL_ERR);
+    }
+
+    prev->next->prev = new_node;
+    prev->next = new_node;
+    cur->list->finger = NULL; // cursors don't track indices
+    cur->list->size++;
+    return (DL_OK);
+}
+
+int dl_cursor_erase(DLCursor *cur) {
+    if (dl_cursor_is_end(cur)) {
+        return (DL_ERR);
+    }
+
+    DLNode *next = helper_delete_node(cur->list, cur->node);
+
+    if (next == NULL) {
+        return (DL_ERR);
+    }
+
+    cur->node = next;
+    cur->list->finger = NULL; // cursors don't track indices
+    cur->list->size--;
+    return (DL_OK);
+}
+
+
+
+/* sort / merge / splice */
+
+/* bottom-up merge sort: runs of 2^i nodes are kept in runs[i] and merged like a binary counter */
+int dl_sort(DoublyList *list, dl_cmp_fn cmp) {
+    if (list == NULL || cmp == NULL) {
+        return (DL_ERR);
+    }
+
+    if (list->size < 2) {
+        return (DL_OK);
+    }
+
+    DLNode *runs[SORT_MAX_RUNS] = { NULL };
+    size_t nruns = 0;
+
+    /* detach the nodes as a NULL-terminated chain */
+    DLNode *node = list->head->next;
+    list->tail->prev->next = NULL;
+
+    while (node != NULL) {
+        DLNode *carry = node;
+        node = node->next;
+        carry->next = NULL;
+
+        size_t i = 0;
+        while (i < nruns && runs[i] != NULL) {
+            carry = helper_merge_runs(runs[i], carry, cmp);
+            runs[i] = NULL;
+            i++;
+        }
+
+        if (i == nruns) {
+            nruns++;
+        }
+        runs[i] = carry;
+    }
+
+    /* higher runs hold earlier elements, so they go on the left */
+    DLNode *sorted = NULL;
+    for (size_t i = 0; i < nruns; ++i) {
+        if (runs[i] != NULL) {
+            sorted = helper_merge_runs(runs[i], sorted, cmp);
+        }
+    }
+
+    /* relink between the dummies and restore the prev links */
+    DLNode *prev = list->head;
+    for (node = sorted; node != NULL; node = node->next) {
+        prev->next = node;
+        node->prev = prev;
+        prev = node;
+    }
+    prev->next = list->tail;
+    list->tail->prev = prev;
+
+    /* a compaction in progress starts its walk over (moved nodes are skipped) */
+    if (list->old_pool != NULL) {
+        list->compact_next = list->head->next;
+    }
+
+    list->finger = NULL;
+    return (DL_OK);
+}
+
+int dl_merge(DoublyList *dst, DoublyList *src, dl_cmp_fn cmp) {
+    if (dst == NULL || src == NULL || cmp == NULL || dst->elem_size != src->elem_size) {
+        return (DL_ERR);
+    }
+
+    if (dst == src || src->size == 0) {
+        return (DL_OK);
+    }
+
+    helper_share_pool(dst, src);
+    DLNode *pos = dst->head->next;
+
+    dst->finger = NULL;
+    src->finger = NULL;
+
+    while (src->size > 0) {
+        DLNode *node = src->head->next;
+
+        /* elements of `dst` go first on ties (stable) */
+        while (pos != dst->tail && cmp(node->data, pos->data) >= 0) {
+            pos = pos->next;
+        }
+
+        /* past the end of `dst`: the rest of `src` moves in one go */
+        if (pos == dst->tail) {
+            helper_move_range(dst, pos, src, node, src->tail, src->size);
+            break;
+        }
+
+        /* move the whole run of `src` that sorts before pos */
+        DLNode *end = node->next;
+        size_t count = 1;
+        while (end != src->tail && cmp(end->data, pos->data) < 0) {
+            end = end->next;
+            count++;
+        }
+
+        helper_move_range(dst, pos, src, node, end, count);
+    }
+
+    return (DL_OK);
+}
+
+int dl_splice(DLCursor *pos, DLCursor *first, DLCursor *last, size_t count) {
+    if (pos == NULL || first == NULL || last == NULL || pos->list == NULL || first->list == NULL
+        || pos->node == NULL || first->node == NULL || last->node == NULL || first->list != last->list
+        || pos->node == pos->list->head || first->node == first->list->head
+        || last->node == last->list->head || pos->list->elem_size != first->list->elem_size) {
+        return (DL_ERR);
+    }
+
+    DoublyList *dst = pos->list;
+    DoublyList *src = first->list;
+
+    if (first->node == last->node || (dst == src && (pos->node == first->node || pos->node == last->node))) {
+        return (DL_OK);
+    }
+
+    if (first->node == src->tail) {
+        return (DL_ERR);
+    }
+
+    if (dst == src) {
+        /* `pos` inside the range would cut it into two loose cycles: walk it once to rule that out */
+        for (DLNode *node = first->node; node != last->node; node = node->next) {
+            if (node == pos->node || node == src->tail) {
+                return (DL_ERR);
+            }
+        }
+
+        /* moving within one list doesn't change the sizes */
+        count = 0;
+    } else {
+        /* the count can't be checked without a walk, only against the whole list */
+        int whole = (first->node == src->head->next && last->node == src->tail);
+
+        if (count == 0 || count > src->size || whole != (count == src->size)) {
+            return (DL_ERR);
+        }
+
+        helper_share_pool(dst, src);
+    }
+
+    dst->finger = NULL;
+    src->finger = NULL;
+
+    helper_move_range(dst, pos->node, src, first->node, last->node, count);
+    first->list = dst;
+    return (DL_OK);
+}
+
+
+
+/* compaction */
+
+/*
+** a compaction moves the nodes, in traversal order, from the current pool
+** (kept as old_pool) into a fresh pool whose first slab is big enough for
+** all of them, compact_next is the next node to visit
+** the list stays usable between steps: new nodes come from the fresh pool,
+** freed nodes go back to the pool owning them, and the walk skips nodes that
+** already live in the fresh pool
+*/
+int dl_compact_step(DoublyList *list, size_t max_nodes) {
+    if (list == NULL) {
+        return (DL_ERR);
+    }
+
+    if (list->old_pool == NULL) {
+        if (list->size == 0) {
+            return (DL_OK);
+        }
+
+        PoolAllocator *fresh = pool_create(sizeof(DLNode) + list->elem_size);
+
+        if (fresh == NULL || pool_reserve(fresh, list->size) == POOL_ERR) {
+            pool_destroy(fresh);
+            return (DL_ERR);
+        }
+
+        list->old_pool = list->pool;
+        list->pool = fresh;
+        list->compact_next = list->head->next;
+    }
+
+    while (max_nodes > 0 && list->compact_next != list->tail) {
+        DLNode *node = list->compact_next;
+        max_nodes--;
+
+        if (pool_owns(list->pool, node)) {
+            list->compact_next = node->next;
+            continue ;
+        }
+
+        DLNode *copy = pool_alloc(list->pool);
+
+        if (copy == NULL) {
+            return (DL_ERR);  // nothing lost, the next step resumes on `node`
+        }
+
+        memcpy(copy->data, node->data, list->elem_size);
+        copy->prev = node->prev;
+        copy->next = node->next;
+        node->prev->next = copy;
+        node->next->prev = copy;
+
+        if (list->finger == node) {
+            list->finger = copy;
+        }
+
+        list->compact_next = copy->next;
+        pool_free(list->old_pool, node);
+    }
+
+    if (list->compact_next != list->tail) {
+        return (DL_PENDING);
+    }
+
+    /* every node lives in the fresh pool now */
+    pool_destroy(list->old_pool);
+    list->old_pool = NULL;
+    list->compact_next = NULL;
+    return (DL_OK);
+}
+
+int dl_compact(DoublyList *list) {
+    return (dl_compact_step(list, SIZE_MAX));
+}
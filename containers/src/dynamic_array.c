@@ -175,6 +175,15 @@ void *da_get(const DynamicArray *arr, size_t index) {
 }
 
 
+/* returns the raw buffer (elements are stored back to back, without gaps) */
+void *da_data(const DynamicArray *arr) {
+    if (arr == NULL) {
+        return (NULL);
+    }
+
+    return (arr->data);
+}
+
 /* return a pointer to the last element in `arr` */
 void *da_back(const DynamicArray *arr) {
     if (arr == NULL || arr->size == 0) {
@@ -211,6 +220,52 @@ int da_push_back(DynamicArray *arr, const void *src) {
     return (DA_OK);
 }
 
+/* appends `count` elements copied from `src` with a single memcpy
+** the capacity is doubled as many times as needed, with one reallocation
+** nothing is changed if the call fails
+*/
+int da_append(DynamicArray *arr, const void *src, size_t count) {
+    if (arr == NULL || arr->data == NULL || (src == NULL && count > 0)) {
+        return (DA_ERR);
+    }
+
+    if (count == 0) {
+        return (DA_OK);
+    }
+
+    if (count > SIZE_MAX / arr->elem_size - arr->size) {
+        return (DA_ERR);
+    }
+
+    size_t needed = arr->size + count;
+
+    if (needed > arr->capacity) {
+        size_t new_capacity = arr->capacity;
+
+        while (new_capacity < needed) {
+            new_capacity = (new_capacity > SIZE_MAX / 2) ? needed : new_capacity * 2;
+        }
+
+        if (new_capacity > SIZE_MAX / arr->elem_size) {
+            new_capacity = needed;
+        }
+
+        void *newData = realloc(arr->data, new_capacity * arr->elem_size);
+
+        if (newData == NULL) {
+            return (DA_ERR);
+        }
+
+        arr->data = newData;
+        arr->capacity = new_capacity;
+    }
+
+    memcpy((char*)arr->data + arr->size * arr->elem_size, src, count * arr->elem_size);
+
+    arr->size += count;
+    return (DA_OK);
+}
+
 /*
 ** sets the given value in the given index
 ** the index must be less than the array size
@@ -0,0 +1,221 @@
+/* implemented interface */
+# include "epoch_reclaim.h"
+
+/* implementation dependencies */
+# include <stdlib.h>
+# include <stdalign.h>
+# include <stdatomic.h>
+
+# define BAGS 3              // an object can be freed two epochs after its retirement
+# define ADVANCE_PERIOD 64   // retirements between two attempts to advance the epoch
+# define CACHE_LINE 64
+
+/*
+** per-section record, borrowed by one critical section at a time
+** `state` is (epoch << 1) | active, read by the threads advancing the epoch
+** the bags belong to the record, not to a thread: whoever borrows it next
+** keeps collecting them
+*/
+typedef struct EpochRecord {
+    alignas(CACHE_LINE) _Atomic int in_use;  // borrowed by a critical section
+    _Atomic size_t state;
+    EpochDomain *domain;
+    struct EpochRecord *next;   // next record of the domain (immutable once published)
+    EBRLink *bags[BAGS];        // retired objects, by epoch % BAGS
+    size_t bag_epoch[BAGS];     // global epoch the objects of each bag were retired in
+    size_t retired;             // retirements since the last advance attempt
+} EpochRecord;
+
+/* private data */
+typedef struct EpochDomain {
+    _Atomic size_t epoch;                 // global epoch, only grows
+    _Atomic(EpochRecord *) records;       // push-only list of records
+} EpochDomain;
+
+
+/* helpers */
+
+static void helper_free_bag(EBRLink *link) {
+    while (link != NULL) {
+        EBRLink *next = link->next;
+        link->free_fn(link);
+        link = next;
+    }
+}
+
+/* frees the bags retired at least two epochs before `epoch` */
+static void helper_collect(EpochRecord *rec, size_t epoch) {
+    for (size_t b = 0; b < BAGS; ++b) {
+        if (rec->bags[b] != NULL && rec->bag_epoch[b] + 2 <= epoch) {
+            helper_free_bag(rec->bags[b]);
+            rec->bags[b] = NULL;
+        }
+    }
+}
+
+/* moves the global epoch forward if every active section has seen the current one */
+static void helper_try_advance(EpochDomain *domain) {
+    size_t epoch = atomic_load(&domain->epoch);
+    EpochRecord *rec = atomic_load_explicit(&domain->records, memory_order_acquire);
+
+    for (; rec != NULL; rec = rec->next) {
+        size_t state = atomic_load(&rec->state);
+
+        if ((state & 1) && (state >> 1) != epoch) {
+            return ;
+        }
+    }
+
+    atomic_compare_exchange_strong(&domain->epoch, &epoch, epoch + 1);
+}
+
+/* borrows a free record, or publishes a new one */
+/* return NULL to indicate failure */
+static EpochRecord *helper_claim(EpochDomain *domain) {
+    EpochRecord *rec = atomic_load_explicit(&domain->records, memory_order_acquire);
+
+    for (; rec != NULL; rec = rec->next) {
+        int expected = 0;
+
+        if (atomic_load_explicit(&rec->in_use, memory_order_relaxed) == 0
+            && atomic_compare_exchange_strong_explicit(&rec->in_use, &expected, 1,
+                memory_order_acquire, memory_order_relaxed)) {
+            return (rec);
+        }
+    }
+
+    rec = aligned_alloc(CACHE_LINE, sizeof(EpochRecord));
+
+    if (rec == NULL) {
+        return (NULL);
+    }
+
+    atomic_init(&rec->in_use, 1);
+    atomic_init(&rec->state, 0);
+    rec->domain = domain;
+    rec->retired = 0;
+
+    for (size_t b = 0; b < BAGS; ++b) {
+        rec->bags[b] = NULL;
+        rec->bag_epoch[b] = 0;
+    }
+
+    EpochRecord *head = atomic_load_explicit(&domain->records, memory_order_relaxed);
+
+    do {
+        rec->next = head;
+    } while (!atomic_compare_exchange_weak_explicit(&domain->records, &head, rec,
+        memory_order_release, memory_order_relaxed));
+
+    return (rec);
+}
+
+
+/* constructor / destructor */
+
+EpochDomain *ebr_create(void) {
+    EpochDomain *domain = malloc(sizeof(EpochDomain));
+
+    if (domain == NULL) {
+        return (NULL);
+    }
+
+    atomic_init(&domain->epoch, 0);
+    atomic_init(&domain->records, NULL);
+
+    return (domain);
+}
+
+void ebr_destroy(EpochDomain *domain) {
+    if (domain == NULL) {
+        return ;
+    }
+
+    EpochRecord *rec = atomic_load_explicit(&domain->records, memory_order_acquire);
+
+    while (rec != NULL) {
+        EpochRecord *next = rec->next;
+
+        for (size_t b = 0; b < BAGS; ++b) {
+            helper_free_bag(rec->bags[b]);
+        }
+
+        free(rec);
+        rec = next;
+    }
+
+    free(domain);
+}
+
+
+/* critical sections */
+
+EpochGuard *ebr_enter(EpochDomain *domain) {
+    if (domain == NULL) {
+        return (NULL);
+    }
+
+    EpochRecord *rec = helper_claim(domain);
+
+    if (rec == NULL) {
+        return (NULL);
+    }
+
+    /*
+    ** publish the epoch, then check it's still current: an advance that
+    ** missed the store could otherwise let the epoch move twice under us
+    */
+    size_t epoch;
+
+    do {
+        epoch = atomic_load(&domain->epoch);
+        atomic_store(&rec->state, (epoch << 1) | 1);
+    } while (atomic_load(&domain->epoch) != epoch);
+
+    helper_collect(rec, epoch);
+
+    return (rec);
+}
+
+void ebr_exit(EpochGuard *guard) {
+    if (guard == NULL) {
+        return ;
+    }
+
+    size_t state = atomic_load_explicit(&guard->state, memory_order_relaxed);
+
+    atomic_store_explicit(&guard->state, state & ~(size_t)1, memory_order_release);
+    atomic_store_explicit(&guard->in_use, 0, memory_order_release);
+}
+
+/*
+** the object is tagged with the global epoch read after it was unlinked:
+** every section that may hold it started at that epoch or earlier, and the
+** epoch can't move two steps past it while one of them is still active
+*/
+int ebr_retire(EpochGuard *guard, EBRLink *link, void (*free_fn)(EBRLink *link)) {
+    if (guard == NULL || link == NULL || free_fn == NULL) {
+        return (EBR_ERR);
+    }
+
+    size_t epoch = atomic_load(&guard->domain->epoch);
+    size_t b = epoch % BAGS;
+
+    /* a bag tagged with an older epoch of the same residue is at least 3 epochs old */
+    if (guard->bag_epoch[b] != epoch) {
+        helper_free_bag(guard->bags[b]);
+        guard->bags[b] = NULL;
+        guard->bag_epoch[b] = epoch;
+    }
+
+    link->free_fn = free_fn;
+    link->next = guard->bags[b];
+    guard->bags[b] = link;
+
+    if (++guard->retired >= ADVANCE_PERIOD) {
+        guard->retired = 0;
+        helper_try_advance(guard->domain);
+    }
+
+    return (EBR_OK);
+}
@@ -4,16 +4,103 @@
 // implementation dependencies
 # include "dynamic_array.h"
 # include <stdlib.h>
+# include <string.h>
 
 # define INITIAL_CAPACITY 1024
-
+# define DEFAULT_ARITY 2
+# define MAX_ARITY 16
+
+/*
+** implicit d-ary tree: the children of node i are d * i + 1 .. d * i + d,
+** its parent is (i - 1) / d
+** with small elements, the d children of a node share a cache line and the
+** tree is log2(d) times shallower than a binary one
+*/
 typedef struct Heap {
     DynamicArray *arr;
     heap_cmp_fn cmp;
+    size_t arity;       // children per node (d)
+    size_t elem_size;   // size of each element in bytes
+    void *moving;       // element carried by the sift loops
 } Heap;
 
-Heap *heap_create(size_t elem_size, heap_cmp_fn cmp) {
-    if (elem_size == 0 || cmp == NULL) {
+/*
+** the sift loops work on the raw buffer with a hole: the moving element is
+** kept aside, each level copies one element into the hole (instead of a
+** three-copy swap), and the moving element is written once at the end
+*/
+
+/* copies one element, with fixed-size copies for the common sizes (turned into plain moves) */
+static inline void helper_copy(void *dst, const void *src, size_t elem_size) {
+    switch (elem_size) {
+        case 4:
+            memcpy(dst, src, 4);
+            break ;
+        case 8:
+            memcpy(dst, src, 8);
+            break ;
+        case 16:
+            memcpy(dst, src, 16);
+            break ;
+        default:
+            memcpy(dst, src, elem_size);
+            break ;
+    }
+}
+
+/* `elem` must not live in the heap's buffer (same for helper_sift_down) */
+/* moves `elem` up from the hole at `hole_i` until its parent has a higher priority */
+static void helper_sift_up(Heap *h, size_t hole_i, const void *elem) {
+    unsigned char *base = da_data(h->arr);
+    size_t es = h->elem_size;
+    size_t d = h->arity;
+
+    while (hole_i > 0) {
+        size_t parent_i = (hole_i - 1) / d;
+
+        if (h->cmp(elem, base + parent_i * es) >= 0) {
+            break ;
+        }
+
+        helper_copy(base + hole_i * es, base + parent_i * es, es);
+        hole_i = parent_i;
+    }
+
+    helper_copy(base + hole_i * es, elem, es);
+}
+
+/* moves `elem` down from the hole at `hole_i` until all its children have a lower priority */
+static void helper_sift_down(Heap *h, size_t hole_i, const void *elem) {
+    unsigned char *base = da_data(h->arr);
+    size_t es = h->elem_size;
+    size_t d = h->arity;
+    size_t size = da_size(h->arr);
+    size_t internal = (size + d - 2) / d;   // nodes [0, internal) have at least one child
+
+    while (hole_i < internal) {
+        size_t first_i = d * hole_i + 1;
+        size_t last_i = (size - first_i > d) ? first_i + d : size;
+        size_t best_i = first_i;
+
+        for (size_t child_i = first_i + 1; child_i < last_i; ++child_i) {
+            if (h->cmp(base + child_i * es, base + best_i * es) < 0) {
+                best_i = child_i;
+            }
+        }
+
+        if (h->cmp(base + best_i * es, elem) >= 0) {
+            break ;
+        }
+
+        helper_copy(base + hole_i * es, base + best_i * es, es);
+        hole_i = best_i;
+    }
+
+    helper_copy(base + hole_i * es, elem, es);
+}
+
+static Heap *helper_create(size_t elem_size, heap_cmp_fn cmp, size_t capacity, size_t arity) {
+    if (elem_size == 0 || cmp == NULL || arity < 2 || arity > MAX_ARITY) {
         return (NULL);
     }
 
@@ -23,14 +110,59 @@ Heap *heap_create(size_t elem_size, heap_cmp_fn cmp) {
         return (NULL);
     }
 
-    h->arr = da_create(INITIAL_CAPACITY, elem_size);
+    h->arr = da_create(capacity, elem_size);
+    h->moving = malloc(elem_size);
 
-    if (h->arr == NULL) {
+    if (h->arr == NULL || h->moving == NULL) {
+        da_destroy(h->arr);
+        free(h->moving);
         free(h);
         return (NULL);
     }
 
     h->cmp = cmp;
+    h->arity = arity;
+    h->elem_size = elem_size;
+
+    return (h);
+}
+
+Heap *heap_create(size_t elem_size, heap_cmp_fn cmp) {
+    return (helper_create(elem_size, cmp, INITIAL_CAPACITY, DEFAULT_ARITY));
+}
+
+Heap *heap_create_arity(size_t elem_size, heap_cmp_fn cmp, size_t arity) {
+    return (helper_create(elem_size, cmp, INITIAL_CAPACITY, arity));
+}
+
+/*
+** Floyd's heapify: the buffer is copied once, then every internal node is
+** sifted down, from the last one up to the root
+** most nodes sit near the bottom and barely move, so the whole build is O(n)
+*/
+Heap *heap_create_from(const void *base, size_t n, size_t elem_size, heap_cmp_fn cmp) {
+    if (base == NULL && n > 0) {
+        return (NULL);
+    }
+
+    Heap *h = helper_create(elem_size, cmp, (n > 0) ? n : INITIAL_CAPACITY, DEFAULT_ARITY);
+
+    if (h == NULL) {
+        return (NULL);
+    }
+
+    if (da_append(h->arr, base, n) == DA_ERR) {
+        heap_destroy(h);
+        return (NULL);
+    }
+
+    /* nodes [0, (n + d - 2) / d) have at least one child (as in helper_sift_down) */
+    unsigned char *data = da_data(h->arr);
+
+    for (size_t i = (n + h->arity - 2) / h->arity; i-- > 0; ) {
+        helper_copy(h->moving, data + i * elem_size, elem_size);
+        helper_sift_down(h, i, h->moving);
+    }
 
     return (h);
 }
@@ -38,6 +170,7 @@ Heap *heap_create(size_t elem_size, heap_cmp_fn cmp) {
 void heap_destroy(Heap *h) {
     if (h != NULL) {
         da_destroy(h->arr);
+        free(h->moving);
         free(h);
     }
 }
@@ -47,31 +180,15 @@ int heap_insert(Heap *h, const void *elem) {
         return (HEAP_ERR);
     }
 
-    if (da_push_back(h->arr, elem) == DA_ERR) {
+    /* `elem` may point into the buffer, which the push can move */
+    helper_copy(h->moving, elem, h->elem_size);
+
+    /* grows the buffer if needed, the new slot is the starting hole */
+    if (da_push_back(h->arr, h->moving) == DA_ERR) {
         return (HEAP_ERR);
     }
 
-    size_t curr_i = da_size(h->arr) - 1;
-
-    while (curr_i > 0) {
-        size_t parent_i = (curr_i - 1) / 2;
-        void *curr = da_get(h->arr, curr_i);
-        void *parent = da_get(h->arr, parent_i);
-
-        if (curr == NULL || parent == NULL) {
-            return (HEAP_ERR);
-        }
-
-        if (h->cmp(curr, parent) >= 0) {
-            break ;
-        }
-
-        if (da_swap(h->arr, curr_i, parent_i) == DA_ERR) {
-            return (HEAP_ERR);
-        }
-
-        curr_i = parent_i;
-    }
+    helper_sift_up(h, da_size(h->arr) - 1, h->moving);
 
     return (HEAP_OK);
 }
@@ -81,38 +198,21 @@ int heap_remove_top(Heap *h) {
         return (HEAP_ERR);
     }
 
-    if (da_swap(h->arr, 0, da_size(h->arr) - 1) == DA_ERR) {
+    size_t size = da_size(h->arr);
+
+    if (size == 0) {
         return (HEAP_ERR);
     }
 
+    /* the last element fills the hole left by the top */
+    helper_copy(h->moving, da_get(h->arr, size - 1), h->elem_size);
+
     if (da_pop(h->arr) == DA_ERR) {
         return (HEAP_ERR);
     }
 
-    size_t curr_i = 0;
-    size_t size = da_size(h->arr);
-
-    while (curr_i < size) {
-        size_t left_i = 2 * curr_i + 1;
-        size_t right_i = 2 * curr_i + 2;
-        size_t highest_priority_i = curr_i;
-
-        if (left_i < size &&
-            h->cmp(da_get(h->arr, left_i), da_get(h->arr, highest_priority_i)) < 0) {
-            highest_priority_i = left_i;
-        }
-
-        if (right_i < size &&
-            h->cmp(da_get(h->arr, right_i), da_get(h->arr, highest_priority_i)) < 0) {
-            highest_priority_i = right_i;
-        }
-
-        if (highest_priority_i == curr_i) {
-            break ;
-        }
-
-        da_swap(h->arr, curr_i, highest_priority_i);
-        curr_i = highest_priority_i;
+    if (size > 1) {
+        helper_sift_down(h, 0, h->moving);
     }
 
     return (HEAP_OK);
@@ -134,6 +234,14 @@ size_t heap_size(const Heap *h) {
     return (da_size(h->arr));
 }
 
+size_t heap_arity(const Heap *h) {
+    if (h == NULL) {
+        return (0);
+    }
+
+    return (h->arity);
+}
+
 int heap_is_empty(const Heap *h) {
     return (h == NULL || heap_size(h) == 0);
 }
@@ -0,0 +1,576 @@
+/* implemented interface */
+# include "index_list.h"
+
+/* implementation dependencies */
+# include <stdlib.h>
+# include <string.h>
+# include <stdint.h>
+
+# define INITIAL_CAPACITY 16   // slots of a fresh list (sentinel included)
+# define SENTINEL 0            // slot 0 links the last element to the first one
+# define NO_SLOT 0             // end of the free chain
+# define SORT_MAX_RUNS 32      // runs of 2^0 .. 2^31 elements, enough for 32-bit slots
+
+/* links of one slot (also used by free slots: `next` chains them) */
+typedef struct IXLLink {
+    uint32_t prev;
+    uint32_t next;
+} IXLLink;
+
+/*
+** private data
+**
+** slot i holds links[i] and the element at data + i * elem_size, slot 0 is
+** the sentinel: links[0].next is the first element and links[0].prev the last
+** slots [1, used) have been handed out at least once, freed ones are chained
+** from free_head
+*/
+typedef struct IndexList {
+    size_t size;           // number of elements
+    size_t elem_size;      // size of each element in bytes
+    IXLLink *links;        // links of every slot
+    unsigned char *data;   // elements of every slot
+    uint32_t capacity;     // number of slots allocated
+    uint32_t used;         // slots handed out so far (the sentinel included)
+    uint32_t free_head;    // first recycled slot, NO_SLOT if none
+    uint32_t finger;       // last slot reached by index, SENTINEL when unknown
+    size_t finger_index;   // index of `finger`
+} IndexList;
+
+
+/* helpers */
+
+/* returns a pointer to the element of `slot` */
+static inline void *helper_at(const IndexList *list, uint32_t slot) {
+    return (list->data + (size_t)slot * list->elem_size);
+}
+
+/* doubles the number of slots, the elements keep their slot index */
+static int helper_grow(IndexList *list) {
+    if (list->capacity > UINT32_MAX / 2 || (size_t)list->capacity * 2 > SIZE_MAX / list->elem_size) {
+        return (IXL_ERR);
+    }
+
+    uint32_t new_cap = list->capacity * 2;
+    IXLLink *links = realloc(list->links, sizeof(IXLLink) * new_cap);
+
+    if (links == NULL) {
+        return (IXL_ERR);
+    }
+    list->links = links;
+
+    unsigned char *data = realloc(list->data, (size_t)new_cap * list->elem_size);
+
+    if (data == NULL) {
+        return (IXL_ERR);  // the larger links array is simply kept
+    }
+    list->data = data;
+    list->capacity = new_cap;
+
+    return (IXL_OK);
+}
+
+/* returns a slot holding a copy of `src`, linked between `prev` and `next` */
+/* return SENTINEL to indicate failure */
+static uint32_t helper_new_slot(IndexList *list, uint32_t prev, uint32_t next, const void *src) {
+    uint32_t slot;
+
+    if (list->free_head != NO_SLOT) {
+        slot = list->free_head;
+        list->free_head = list->links[slot].next;
+    } else {
+        if (list->used == list->capacity) {
+            /* `src` may be one of the list's own elements, which the growth moves */
+            uintptr_t begin = (uintptr_t)list->data;
+            uintptr_t offset = (uintptr_t)src - begin;
+            int inside = (uintptr_t)src >= begin && offset < (size_t)list->capacity * list->elem_size;
+
+            if (helper_grow(list) == IXL_ERR) {
+                return (SENTINEL);
+            }
+            if (inside) {
+                src = list->data + offset;
+            }
+        }
+        slot = list->used++;
+    }
+
+    memcpy(helper_at(list, slot), src, list->elem_size);
+    list->links[slot].prev = prev;
+    list->links[slot].next = next;
+    list->links[prev].next = slot;
+    list->links[next].prev = slot;
+    list->size++;
+
+    return (slot);
+}
+
+/* unlinks `slot` and chains it into the free slots, returns the slot that followed it */
+static uint32_t helper_delete_slot(IndexList *list, uint32_t slot) {
+    uint32_t prev = list->links[slot].prev;
+    uint32_t next = list->links[slot].next;
+
+    list->links[prev].next = next;
+    list->links[next].prev = prev;
+
+    list->links[slot].next = list->free_head;
+    list->free_head = slot;
+    list->size--;
+
+    return (next);
+}
+
+/* returns the slot of the element at the index `index` (< size) */
+/* the walk starts from whichever of first, last or finger is closest (sequential access is O(1)) */
+static uint32_t helper_get_slot(IndexList *list, size_t index) {
+    const IXLLink *links = list->links;
+    uint32_t curr = links[SENTINEL].next;
+    size_t i = 0;
+    size_t distance = index;
+
+    /* or from the last element */
+    if (list->size - 1 - index < distance) {
+        curr = links[SENTINEL].prev;
+        i = list->size - 1;
+        distance = list->size - 1 - index;
+    }
+
+    /* or from the finger */
+    if (list->finger != SENTINEL) {
+        size_t fi = list->finger_index;
+        size_t finger_distance = (fi > index) ? fi - index : index - fi;
+
+        if (finger_distance < distance) {
+            curr = list->finger;
+            i = fi;
+        }
+    }
+
+    while (i < index) {
+        curr = links[curr].next;
+        i++;
+    }
+
+    while (i > index) {
+        curr = links[curr].prev;
+        i--;
+    }
+
+    list->finger = curr;
+    list->finger_index = index;
+
+    return (curr);
+}
+
+/* keeps the finger on the same slot when an element is inserted at `index` */
+static void helper_finger_inserted(IndexList *list, size_t index) {
+    if (list->finger != SENTINEL && index <= list->finger_index) {
+        list->finger_index++;
+    }
+}
+
+/* keeps the finger usable when the element of `slot` at `index` is about to be removed */
+static void helper_finger_removed(IndexList *list, size_t index, uint32_t slot) {
+    if (list->finger == SENTINEL) {
+        return ;
+    }
+
+    if (list->finger == slot) {
+        /* step back onto the previous slot, so removal loops keep their O(1) walk */
+        list->finger = list->links[slot].prev;
+        list->finger_index = index - 1;
+    } else if (index < list->finger_index) {
+        list->finger_index--;
+    }
+}
+
+/* stable merge of two runs chained through `next` and ended by SENTINEL (prev is left stale) */
+static uint32_t helper_merge_runs(IndexList *list, uint32_t a, uint32_t b, ixl_cmp_fn cmp) {
+    IXLLink *links = list->links;
+    uint32_t merged = SENTINEL;
+    uint32_t last = SENTINEL;
+
+    while (a != SENTINEL && b != SENTINEL) {
+        uint32_t pick;
+
+        /* on ties, the element from the earlier run `a` goes first */
+        if (cmp(helper_at(list, b), helper_at(list, a)) < 0) {
+            pick = b;
+            b = links[b].next;
+        } else {
+            pick = a;
+            a = links[a].next;
+        }
+
+        if (last == SENTINEL) {
+            merged = pick;
+        } else {
+            links[last].next = pick;
+        }
+        last = pick;
+    }
+
+    uint32_t rest = (a != SENTINEL) ? a : b;
+
+    if (last == SENTINEL) {
+        return (rest);
+    }
+
+    links[last].next = rest;
+    return (merged);
+}
+
+
+/* constructor / destructor */
+
+/* elem_size must be greater than 0 */
+/* return NULL to indicate construction failure */
+IndexList *ixl_create(size_t elem_size) {
+    if (elem_size == 0 || elem_size > SIZE_MAX / INITIAL_CAPACITY) {
+        return (NULL);
+    }
+
+    IndexList *list = malloc(sizeof(IndexList));
+
+    if (list == NULL) {
+        return (NULL);
+    }
+
+    list->links = malloc(sizeof(IXLLink) * INITIAL_CAPACITY);
+    list->data = malloc(elem_size * INITIAL_CAPACITY);
+
+    if (list->links == NULL || list->data == NULL) {
+        free(list->links);
+        free(list->data);
+        free(list);
+        return (NULL);
+    }
+
+    list->size = 0;
+    list->elem_size = elem_size;
+    list->capacity = INITIAL_CAPACITY;
+    list->used = 1;
+    list->free_head = NO_SLOT;
+    list->finger = SENTINEL;
+    list->finger_index = 0;
+    list->links[SENTINEL].prev = SENTINEL;
+    list->links[SENTINEL].next = SENTINEL;
+
+    return (list);
+}
+
+void ixl_destroy(IndexList *list) {
+    if (list == NULL) {
+        return ;
+    }
+
+    free(list->links);
+    free(list->data);
+    free(list);
+}
+
+
+/* insertion */
+
+int ixl_push_front(IndexList *list, const void *src) {
+    if (list == NULL || src == NULL) {
+        return (IXL_ERR);
+    }
+
+    if (helper_new_slot(list, SENTINEL, list->links[SENTINEL].next, src) == SENTINEL) {
+        return (IXL_ERR);
+    }
+
+    helper_finger_inserted(list, 0);
+    return (IXL_OK);
+}
+
+int ixl_push_back(IndexList *list, const void *src) {
+    if (list == NULL || src == NULL) {
+        return (IXL_ERR);
+    }
+
+    if (helper_new_slot(list, list->links[SENTINEL].prev, SENTINEL, src) == SENTINEL) {
+        return (IXL_ERR);
+    }
+
+    return (IXL_OK);
+}
+
+/* index must be within the range [0, size] */
+int ixl_insert_at(IndexList *list, size_t index, const void *src) {
+    if (list == NULL || src == NULL || index > list->size) {
+        return (IXL_ERR);
+    }
+
+    if (index == 0) {
+        return (ixl_push_front(list, src));
+    }
+
+    if (index == list->size) {
+        return (ixl_push_back(list, src));
+    }
+
+    uint32_t next = helper_get_slot(list, index);
+
+    if (helper_new_slot(list, list->links[next].prev, next, src) == SENTINEL) {
+        return (IXL_ERR);
+    }
+
+    helper_finger_inserted(list, index);
+    return (IXL_OK);
+}
+
+
+/* deletion */
+
+int ixl_pop_front(IndexList *list) {
+    if (list == NULL || list->size == 0) {
+        return (IXL_ERR);
+    }
+
+    uint32_t slot = list->links[SENTINEL].next;
+
+    helper_finger_removed(list, 0, slot);
+    helper_delete_slot(list, slot);
+    return (IXL_OK);
+}
+
+int ixl_pop_back(IndexList *list) {
+    if (list == NULL || list->size == 0) {
+        return (IXL_ERR);
+    }
+
+    uint32_t slot = list->links[SENTINEL].prev;
+
+    helper_finger_removed(list, list->size - 1, slot);
+    helper_delete_slot(list, slot);
+    return (IXL_OK);
+}
+
+/* index must be in the range [0, size - 1] */
+int ixl_remove_at(IndexList *list, size_t index) {
+    if (list == NULL || index >= list->size) {
+        return (IXL_ERR);
+    }
+
+    uint32_t slot = helper_get_slot(list, index);
+
+    helper_finger_removed(list, index, slot);
+    helper_delete_slot(list, slot);
+    return (IXL_OK);
+}
+
+
+/* access */
+
+void *ixl_front(const IndexList *list) {
+    if (list == NULL || list->size == 0) {
+        return (NULL);
+    }
+
+    return (helper_at(list, list->links[SENTINEL].next));
+}
+
+void *ixl_back(const IndexList *list) {
+    if (list == NULL || list->size == 0) {
+        return (NULL);
+    }
+
+    return (helper_at(list, list->links[SENTINEL].prev));
+}
+
+void *ixl_get(IndexList *list, size_t index) {
+    if (list == NULL || index >= list->size) {
+        return (NULL);
+    }
+
+    return (helper_at(list, helper_get_slot(list, index)));
+}
+
+
+/* utilities */
+
+size_t ixl_size(const IndexList *list) {
+    if (list == NULL) {
+        return (0);
+    }
+
+    return (list->size);
+}
+
+int ixl_is_empty(const IndexList *list) {
+    return (list == NULL || list->size == 0);
+}
+
+/* clears the list, after this call, the list->size is 0 */
+void ixl_clear(IndexList *list) {
+    if (list == NULL) {
+        return ;
+    }
+
+    /* every slot becomes unused again, no walk needed */
+    list->used = 1;
+    list->free_head = NO_SLOT;
+    list->finger = SENTINEL;
+    list->links[SENTINEL].prev = SENTINEL;
+    list->links[SENTINEL].next = SENTINEL;
+    list->size = 0;
+}
+
+/* bottom-up merge sort: runs of 2^i elements are kept in runs[i] and merged like a binary counter */
+int ixl_sort(IndexList *list, ixl_cmp_fn cmp) {
+    if (list == NULL || cmp == NULL) {
+        return (IXL_ERR);
+    }
+
+    if (list->size < 2) {
+        return (IXL_OK);
+    }
+
+    IXLLink *links = list->links;
+    uint32_t runs[SORT_MAX_RUNS] = { SENTINEL };
+    size_t nruns = 0;
+
+    /* the chain already ends on the sentinel */
+    uint32_t slot = links[SENTINEL].next;
+
+    while (slot != SENTINEL) {
+        uint32_t carry = slot;
+        slot = links[slot].next;
+        links[carry].next = SENTINEL;
+
+        size_t i = 0;
+        while (i < nruns && runs[i] != SENTINEL) {
+            carry = helper_merge_runs(list, runs[i], carry, cmp);
+            runs[i] = SENTINEL;
+            i++;
+        }
+
+        if (i == nruns) {
+            nruns++;
+        }
+        runs[i] = carry;
+    }
+
+    /* higher runs hold earlier elements, so they go on the left */
+    uint32_t sorted = SENTINEL;
+    for (size_t i = 0; i < nruns; ++i) {
+        if (runs[i] != SENTINEL) {
+            sorted = helper_merge_runs(list, runs[i], sorted, cmp);
+        }
+    }
+
+    /* restore the prev links and close the ring on the sentinel */
+    uint32_t prev = SENTINEL;
+    for (slot = sorted; slot != SENTINEL; slot = links[slot].next) {
+        links[prev].next = slot;
+        links[slot].prev = prev;
+        prev = slot;
+    }
+    links[prev].next = SENTINEL;
+    links[SENTINEL].prev = prev;
+
+    list->finger = SENTINEL;
+    return (IXL_OK);
+}
+
+
+/* cursor */
+
+IXLCursor ixl_cursor_begin(IndexList *list) {
+    IXLCursor cur = { NULL, SENTINEL };
+
+    if (list == NULL) {
+        return (cur);
+    }
+
+    cur.list = list;
+    cur.slot = list->links[SENTINEL].next; // the sentinel when empty
+
+    return (cur);
+}
+
+IXLCursor ixl_cursor_last(IndexList *list) {
+    IXLCursor cur = { NULL, SENTINEL };
+
+    if (list == NULL) {
+        return (cur);
+    }
+
+    cur.list = list;
+    cur.slot = list->links[SENTINEL].prev; // the sentinel when empty
+
+    return (cur);
+}
+
+int ixl_cursor_is_end(const IXLCursor *cur) {
+    return (cur == NULL || cur->list == NULL || cur->slot == SENTINEL);
+}
+
+int ixl_cursor_next(IXLCursor *cur) {
+    if (ixl_cursor_is_end(cur)) {
+        return (IXL_ERR);
+    }
+
+    cur->slot = cur->list->links[cur->slot].next;
+    return (IXL_OK);
+}
+
+/* the sentinel's `prev` is the last element: the end position steps back onto it */
+int ixl_cursor_prev(IXLCursor *cur) {
+    if (cur == NULL || cur->list == NULL || cur->list->links[cur->slot].prev == SENTINEL) {
+        return (IXL_ERR);
+    }
+
+    cur->slot = cur->list->links[cur->slot].prev;
+    return (IXL_OK);
+}
+
+void *ixl_cursor_get(const IXLCursor *cur) {
+    if (ixl_cursor_is_end(cur)) {
+        return (NULL);
+    }
+
+    return (helper_at(cur->list, cur->slot));
+}
+
+int ixl_cursor_insert_before(IXLCursor *cur, const void *src) {
+    if (cur == NULL || cur->list == NULL || src == NULL) {
+        return (IXL_ERR);
+    }
+
+    IndexList *list = cur->list;
+
+    if (helper_new_slot(list, list->links[cur->slot].prev, cur->slot, src) == SENTINEL) {
+        return (IXL_ERR);
+    }
+
+    list->finger = SENTINEL; // cursors don't track indices
+    return (IXL_OK);
+}
+
+int ixl_cursor_insert_after(IXLCursor *cur, const void *src) {
+    if (cur == NULL || cur->list == NULL || src == NULL) {
+        return (IXL_ERR);
+    }
+
+    IndexList *list = cur->list;
+
+    if (helper_new_slot(list, cur->slot, list->links[cur->slot].next, src) == SENTINEL) {
+        return (IXL_ERR);
+    }
+
+    list->finger = SENTINEL; // cursors don't track indices
+    return (IXL_OK);
+}
+
+int ixl_cursor_erase(IXLCursor *cur) {
+    if (ixl_cursor_is_end(cur)) {
+        return (IXL_ERR);
+    }
+
+    cur->slot = helper_delete_slot(cur->list, cur->slot);
+    cur->list->finger = SENTINEL; // cursors don't track indices
+    return (IXL_OK);
+}
@@ -0,0 +1,276 @@
+// implemented interface
+# include "indexed_pq.h"
+
+// implementation dependencies
+# include <stdlib.h>
+# include <string.h>
+# include <stdint.h>
+
+# define INITIAL_CAPACITY 64
+
+/*
+** `slots` holds the element of handle h at h * elem_size, it never moves
+** `heap` is a binary heap of handles over [0, size), and `pos[h]` is the
+** index of h in `heap`
+** the released handles are kept in heap[size, issued): a pop or remove
+** swaps the leaving handle with the last one, so it lands right past the
+** heap, and a push picks heap[size] back up before issuing a new handle
+** a handle is queued iff pos[h] < size
+*/
+typedef struct IndexedPQ {
+    unsigned char *slots;   // elements, indexed by handle
+    size_t *heap;           // handles: queued in [0, size), released in [size, issued)
+    size_t *pos;            // index of each handle in `heap`
+    size_t size;            // number of queued elements
+    size_t issued;          // number of handles ever handed out
+    size_t capacity;        // number of slots of each array
+    size_t elem_size;
+    ipq_cmp_fn cmp;
+    void *moving;           // copy of a pushed element while `slots` grows
+} IndexedPQ;
+
+/* private helpers */
+
+static inline void *helper_elem(const IndexedPQ *ipq, size_t handle) {
+    return (ipq->slots + handle * ipq->elem_size);
+}
+
+static inline void helper_place(IndexedPQ *ipq, size_t i, size_t handle) {
+    ipq->heap[i] = handle;
+    ipq->pos[handle] = i;
+}
+
+/* doubles the capacity of the three arrays, nothing changes (but their allocation) on failure */
+static int helper_grow(IndexedPQ *ipq) {
+    if (ipq->capacity > SIZE_MAX / 2 / ipq->elem_size
+        || ipq->capacity > SIZE_MAX / 2 / sizeof(size_t)) {
+        return (IPQ_ERR);
+    }
+
+    size_t new_capacity = ipq->capacity * 2;
+    unsigned char *slots = realloc(ipq->slots, new_capacity * ipq->elem_size);
+
+    if (slots == NULL) {
+        return (IPQ_ERR);
+    }
+    ipq->slots = slots;
+
+    size_t *heap = realloc(ipq->heap, new_capacity * sizeof(size_t));
+
+    if (heap == NULL) {
+        return (IPQ_ERR);
+    }
+    ipq->heap = heap;
+
+    size_t *pos = realloc(ipq->pos, new_capacity * sizeof(size_t));
+
+    if (pos == NULL) {
+        return (IPQ_ERR);
+    }
+    ipq->pos = pos;
+
+    ipq->capacity = new_capacity;
+    return (IPQ_OK);
+}
+
+/* moves `handle` up from the hole at `i` (only handles move, the elements stay in their slots) */
+/* returns its final index */
+static size_t helper_sift_up(IndexedPQ *ipq, size_t i, size_t handle) {
+    const void *elem = helper_elem(ipq, handle);
+
+    while (i > 0) {
+        size_t parent_i = (i - 1) / 2;
+
+        if (ipq->cmp(elem, helper_elem(ipq, ipq->heap[parent_i])) >= 0) {
+            break ;
+        }
+
+        helper_place(ipq, i, ipq->heap[parent_i]);
+        i = parent_i;
+    }
+
+    helper_place(ipq, i, handle);
+    return (i);
+}
+
+/* moves `handle` down from the hole at `i` */
+static void helper_sift_down(IndexedPQ *ipq, size_t i, size_t handle) {
+    const void *elem = helper_elem(ipq, handle);
+    size_t half = ipq->size / 2;   // nodes [0, half) have at least one child
+
+    while (i < half) {
+        size_t best_i = 2 * i + 1;
+
+        if (best_i + 1 < ipq->size
+            && ipq->cmp(helper_elem(ipq, ipq->heap[best_i + 1]), helper_elem(ipq, ipq->heap[best_i])) < 0) {
+            ++best_i;
+        }
+
+        if (ipq->cmp(helper_elem(ipq, ipq->heap[best_i]), elem) >= 0) {
+            break ;
+        }
+
+        helper_place(ipq, i, ipq->heap[best_i]);
+        i = best_i;
+    }
+
+    helper_place(ipq, i, handle);
+}
+
+/* takes the handle at heap index `i` out of the heap and parks it past the end */
+static void helper_detach(IndexedPQ *ipq, size_t i) {
+    size_t handle = ipq->heap[i];
+    size_t last = ipq->heap[--ipq->size];
+
+    if (i != ipq->size) {
+        /* the last handle fills the hole, it may belong above or below it */
+        if (helper_sift_up(ipq, i, last) == i) {
+            helper_sift_down(ipq, i, last);
+        }
+    }
+
+    helper_place(ipq, ipq->size, handle);
+}
+
+IndexedPQ *ipq_create(size_t elem_size, ipq_cmp_fn cmp) {
+    if (elem_size == 0 || cmp == NULL || elem_size > SIZE_MAX / INITIAL_CAPACITY) {
+        return (NULL);
+    }
+
+    IndexedPQ *ipq = malloc(sizeof(IndexedPQ));
+
+    if (ipq == NULL) {
+        return (NULL);
+    }
+
+    ipq->slots = malloc(INITIAL_CAPACITY * elem_size);
+    ipq->heap = malloc(INITIAL_CAPACITY * sizeof(size_t));
+    ipq->pos = malloc(INITIAL_CAPACITY * sizeof(size_t));
+    ipq->moving = malloc(elem_size);
+
+    if (ipq->slots == NULL || ipq->heap == NULL || ipq->pos == NULL || ipq->moving == NULL) {
+        ipq_destroy(ipq);
+        return (NULL);
+    }
+
+    ipq->size = 0;
+    ipq->issued = 0;
+    ipq->capacity = INITIAL_CAPACITY;
+    ipq->elem_size = elem_size;
+    ipq->cmp = cmp;
+
+    return (ipq);
+}
+
+void ipq_destroy(IndexedPQ *ipq) {
+    if (ipq != NULL) {
+        free(ipq->slots);
+        free(ipq->heap);
+        free(ipq->pos);
+        free(ipq->moving);
+        free(ipq);
+    }
+}
+
+size_t ipq_push(IndexedPQ *ipq, const void *elem) {
+    if (ipq == NULL || elem == NULL) {
+        return (IPQ_NO_HANDLE);
+    }
+
+    size_t handle;
+
+    if (ipq->size < ipq->issued) {
+        handle = ipq->heap[ipq->size];   // most recently released handle
+    } else {
+        if (ipq->issued == ipq->capacity) {
+            /* `elem` may point into `slots`, which the growth moves */
+            memcpy(ipq->moving, elem, ipq->elem_size);
+            elem = ipq->moving;
+
+            if (helper_grow(ipq) == IPQ_ERR) {
+                return (IPQ_NO_HANDLE);
+            }
+        }
+        handle = ipq->issued++;
+    }
+
+    memcpy(helper_elem(ipq, handle), elem, ipq->elem_size);
+    helper_sift_up(ipq, ipq->size++, handle);
+
+    return (handle);
+}
+
+int ipq_pop(IndexedPQ *ipq) {
+    if (ipq == NULL || ipq->size == 0) {
+        return (IPQ_ERR);
+    }
+
+    helper_detach(ipq, 0);
+    return (IPQ_OK);
+}
+
+int ipq_update(IndexedPQ *ipq, size_t handle, const void *elem) {
+    if (!ipq_contains(ipq, handle) || elem == NULL) {
+        return (IPQ_ERR);
+    }
+
+    size_t i = ipq->pos[handle];
+
+    /* memmove: `elem` may be the slot itself (re-sifting after a change made through ipq_get) */
+    memmove(helper_elem(ipq, handle), elem, ipq->elem_size);
+
+    if (helper_sift_up(ipq, i, handle) == i) {
+        helper_sift_down(ipq, i, handle);
+    }
+
+    return (IPQ_OK);
+}
+
+int ipq_remove(IndexedPQ *ipq, size_t handle) {
+    if (!ipq_contains(ipq, handle)) {
+        return (IPQ_ERR);
+    }
+
+    helper_detach(ipq, ipq->pos[handle]);
+    return (IPQ_OK);
+}
+
+int ipq_contains(const IndexedPQ *ipq, size_t handle) {
+    return (ipq != NULL && handle < ipq->issued && ipq->pos[handle] < ipq->size);
+}
+
+void *ipq_get(const IndexedPQ *ipq, size_t handle) {
+    if (!ipq_contains(ipq, handle)) {
+        return (NULL);
+    }
+
+    return (helper_elem(ipq, handle));
+}
+
+void *ipq_top(const IndexedPQ *ipq) {
+    if (ipq == NULL || ipq->size == 0) {
+        return (NULL);
+    }
+
+    return (helper_elem(ipq, ipq->heap[0]));
+}
+
+size_t ipq_top_handle(const IndexedPQ *ipq) {
+    if (ipq == NULL || ipq->size == 0) {
+        return (IPQ_NO_HANDLE);
+    }
+
+    return (ipq->heap[0]);
+}
+
+size_t ipq_size(const IndexedPQ *ipq) {
+    if (ipq == NULL) {
+        return (0);
+    }
+
+    return (ipq->size);
+}
+
+int ipq_is_empty(const IndexedPQ *ipq) {
+    return (ipq == NULL || ipq->size == 0);
+}
@@ -0,0 +1,213 @@
+/* implemented interface */
+# include "intrusive_list.h"
+
+/* implementation dependencies */
+# include <stdlib.h>
+
+
+/* helpers */
+
+/* links `link` between the adjacent links `prev` and `next` */
+static void helper_link(IList *list, IListLink *prev, IListLink *next, IListLink *link) {
+    link->prev = prev;
+    link->next = next;
+    prev->next = link;
+    next->prev = link;
+    list->size++;
+}
+
+/* unlinks `link` and marks it unlinked */
+static void helper_unlink(IList *list, IListLink *link) {
+    link->prev->next = link->next;
+    link->next->prev = link->prev;
+    link->prev = NULL;
+    link->next = NULL;
+    list->size--;
+}
+
+/* a link that can be inserted: valid and not in any list */
+static int helper_is_free(const IListLink *link) {
+    return (link != NULL && link->next == NULL && link->prev == NULL);
+}
+
+/* a link that can be unlinked from `list`: linked and not the sentinel */
+static int helper_is_member(const IList *list, const IListLink *link) {
+    return (list != NULL && list->size > 0 && ilist_is_linked(link) && link != &list->sentinel);
+}
+
+
+/* initialization */
+
+void ilist_init(IList *list) {
+    if (list == NULL) {
+        return ;
+    }
+
+    list->sentinel.prev = &list->sentinel;
+    list->sentinel.next = &list->sentinel;
+    list->size = 0;
+}
+
+void ilist_link_init(IListLink *link) {
+    if (link == NULL) {
+        return ;
+    }
+
+    link->prev = NULL;
+    link->next = NULL;
+}
+
+int ilist_is_linked(const IListLink *link) {
+    return (link != NULL && link->next != NULL);
+}
+
+
+/* insertion */
+
+int ilist_push_front(IList *list, IListLink *link) {
+    if (list == NULL || !helper_is_free(link)) {
+        return (ILIST_ERR);
+    }
+
+    helper_link(list, &list->sentinel, list->sentinel.next, link);
+    return (ILIST_OK);
+}
+
+int ilist_push_back(IList *list, IListLink *link) {
+    if (list == NULL || !helper_is_free(link)) {
+        return (ILIST_ERR);
+    }
+
+    helper_link(list, list->sentinel.prev, &list->sentinel, link);
+    return (ILIST_OK);
+}
+
+int ilist_insert_before(IList *list, IListLink *pos, IListLink *link) {
+    if (!helper_is_member(list, pos) || !helper_is_free(link)) {
+        return (ILIST_ERR);
+    }
+
+    helper_link(list, pos->prev, pos, link);
+    return (ILIST_OK);
+}
+
+int ilist_insert_after(IList *list, IListLink *pos, IListLink *link) {
+    if (!helper_is_member(list, pos) || !helper_is_free(link)) {
+        return (ILIST_ERR);
+    }
+
+    helper_link(list, pos, pos->next, link);
+    return (ILIST_OK);
+}
+
+
+/* deletion */
+
+int ilist_remove(IList *list, IListLink *link) {
+    if (!helper_is_member(list, link)) {
+        return (ILIST_ERR);
+    }
+
+    helper_unlink(list, link);
+    return (ILIST_OK);
+}
+
+IListLink *ilist_pop_front(IList *list) {
+    IListLink *link = ilist_front(list);
+
+    if (link != NULL) {
+        helper_unlink(list, link);
+    }
+
+    return (link);
+}
+
+IListLink *ilist_pop_back(IList *list) {
+    IListLink *link = ilist_back(list);
+
+    if (link != NULL) {
+        helper_unlink(list, link);
+    }
+
+    return (link);
+}
+
+
+/* moving */
+
+int ilist_move_to_front(IList *dst, IList *src, IListLink *link) {
+    if (dst == NULL || !helper_is_member(src, link)) {
+        return (ILIST_ERR);
+    }
+
+    helper_unlink(src, link);
+    helper_link(dst, &dst->sentinel, dst->sentinel.next, link);
+    return (ILIST_OK);
+}
+
+int ilist_move_to_back(IList *dst, IList *src, IListLink *link) {
+    if (dst == NULL || !helper_is_member(src, link)) {
+        return (ILIST_ERR);
+    }
+
+    helper_unlink(src, link);
+    helper_link(dst, dst->sentinel.prev, &dst->sentinel, link);
+    return (ILIST_OK);
+}
+
+
+/* access */
+
+IListLink *ilist_front(const IList *list) {
+    if (list == NULL || list->size == 0) {
+        return (NULL);
+    }
+
+    return (list->sentinel.next);
+}
+
+IListLink *ilist_back(const IList *list) {
+    if (list == NULL || list->size == 0) {
+        return (NULL);
+    }
+
+    return (list->sentinel.prev);
+}
+
+IListLink *ilist_next(const IList *list, const IListLink *link) {
+    if (!helper_is_member(list, link) || link->next == &list->sentinel) {
+        return (NULL);
+    }
+
+    return (link->next);
+}
+
+IListLink *ilist_prev(const IList *list, const IListLink *link) {
+    if (!helper_is_member(list, link) || link->prev == &list->sentinel) {
+        return (NULL);
+    }
+
+    return (link->prev);
+}
+
+
+/* utilities */
+
+size_t ilist_size(const IList *list) {
+    if (list == NULL) {
+        return (0);
+    }
+
+    return (list->size);
+}
+
+int ilist_is_empty(const IList *list) {
+    return (list == NULL || list->size == 0);
+}
+
+/* clears the list, after this call, every former member is unlinked */
+void ilist_clear(IList *list) {
+    while (ilist_pop_front(list) != NULL) {
+        ;
+    }
+}
@@ -0,0 +1,338 @@
+/* implemented interface */
+# include "lockfree_list.h"
+
+/* implementation dependencies */
+# include "epoch_reclaim.h"
+# include <stdlib.h>
+# include <string.h>
+# include <stdint.h>
+# include <stdalign.h>
+# include <stdatomic.h>
+
+# define MARK ((uintptr_t)1)   // low bit of `next`: the node holding it is deleted
+
+typedef struct LFLNode {
+    _Atomic uintptr_t next;   // next node, possibly marked
+    EBRLink reclaim;          // link used once the node is retired
+    alignas(max_align_t) unsigned char data[];
+} LFLNode;
+
+/* private data */
+typedef struct LockFreeList {
+    _Atomic uintptr_t head;   // first node (never marked)
+    _Atomic size_t size;      // number of elements not logically deleted
+    size_t elem_size;         // size of each element in bytes
+    lfl_cmp_fn cmp;           // ordering used by insert / erase / find
+    EpochDomain *domain;      // reclaims the unlinked nodes
+} LockFreeList;
+
+
+/* helpers */
+
+static inline LFLNode *helper_ptr(uintptr_t link) {
+    return ((LFLNode *)(link & ~MARK));
+}
+
+static inline int helper_is_marked(uintptr_t link) {
+    return ((link & MARK) != 0);
+}
+
+static void helper_free_node(EBRLink *link) {
+    free(EBR_ENTRY(link, LFLNode, reclaim));
+}
+
+/* return NULL to indicate failure */
+static LFLNode *helper_new_node(const LockFreeList *list, const void *elem) {
+    LFLNode *node = malloc(sizeof(LFLNode) + list->elem_size);
+
+    if (node == NULL) {
+        return (NULL);
+    }
+
+    atomic_init(&node->next, 0);
+    memcpy(node->data, elem, list->elem_size);
+
+    return (node);
+}
+
+/* unlinks `curr` (marked) from `*prev`, the thread winning the CAS retires it */
+static int helper_unlink(EpochGuard *guard, _Atomic uintptr_t *prev, LFLNode *curr, uintptr_t succ) {
+    uintptr_t expected = (uintptr_t)curr;
+
+    if (!atomic_compare_exchange_strong_explicit(prev, &expected, succ & ~MARK,
+        memory_order_acq_rel, memory_order_acquire)) {
+        return (0);
+    }
+
+    ebr_retire(guard, &curr->reclaim, helper_free_node);
+    return (1);
+}
+
+/*
+** finds the first unmarked node not less than `key` (NULL if none) and the
+** link pointing to it, unlinking the marked nodes met on the way
+** restarts from the head whenever an unlink loses a race
+*/
+static LFLNode *helper_search(LockFreeList *list, EpochGuard *guard, const void *key, _Atomic uintptr_t **prev_out) {
+retry:
+    ;
+    _Atomic uintptr_t *prev = &list->head;
+    LFLNode *curr = helper_ptr(atomic_load_explicit(prev, memory_order_acquire));
+
+    while (curr != NULL) {
+        uintptr_t succ = atomic_load_explicit(&curr->next, memory_order_acquire);
+
+        if (helper_is_marked(succ)) {
+            if (!helper_unlink(guard, prev, curr, succ)) {
+                goto retry;
+            }
+            curr = helper_ptr(succ);
+            continue ;
+        }
+
+        if (list->cmp(curr->data, key) >= 0) {
+            break ;
+        }
+
+        prev = &curr->next;
+        curr = helper_ptr(succ);
+    }
+
+    *prev_out = prev;
+    return (curr);
+}
+
+
+/* constructor / destructor */
+
+LockFreeList *lfl_create(size_t elem_size, lfl_cmp_fn cmp) {
+    if (elem_size == 0 || elem_size > SIZE_MAX - sizeof(LFLNode)) {
+        return (NULL);
+    }
+
+    LockFreeList *list = malloc(sizeof(LockFreeList));
+
+    if (list == NULL) {
+        return (NULL);
+    }
+
+    list->domain = ebr_create();
+
+    if (list->domain == NULL) {
+        free(list);
+        return (NULL);
+    }
+
+    atomic_init(&list->head, 0);
+    atomic_init(&list->size, 0);
+    list->elem_size = elem_size;
+    list->cmp = cmp;
+
+    return (list);
+}
+
+void lfl_destroy(LockFreeList *list) {
+    if (list == NULL) {
+        return ;
+    }
+
+    /* nodes still linked (marked or not), then the retired ones */
+    LFLNode *node = helper_ptr(atomic_load_explicit(&list->head, memory_order_acquire));
+
+    while (node != NULL) {
+        LFLNode *next = helper_ptr(atomic_load_explicit(&node->next, memory_order_relaxed));
+        free(node);
+        node = next;
+    }
+
+    ebr_destroy(list->domain);
+    free(list);
+}
+
+
+/* modifiers */
+
+int lfl_push_front(LockFreeList *list, const void *elem) {
+    if (list == NULL || elem == NULL) {
+        return (LFL_ERR);
+    }
+
+    LFLNode *node = helper_new_node(list, elem);
+
+    if (node == NULL) {
+        return (LFL_ERR);
+    }
+
+    /* no critical section needed: the head is never freed and `node` is ours */
+    uintptr_t head = atomic_load_explicit(&list->head, memory_order_relaxed);
+
+    do {
+        atomic_store_explicit(&node->next, head, memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak_explicit(&list->head, &head, (uintptr_t)node,
+        memory_order_release, memory_order_relaxed));
+
+    atomic_fetch_add_explicit(&list->size, 1, memory_order_relaxed);
+    return (LFL_OK);
+}
+
+/*
+** marks the first node, then tries to unlink it once: if a push got in front
+** of it meanwhile, it stays linked (marked) until a later pop or search
+** walks over it
+*/
+int lfl_pop_front(LockFreeList *list, void *out) {
+    if (list == NULL) {
+        return (LFL_ERR);
+    }
+
+    EpochGuard *guard = ebr_enter(list->domain);
+
+    if (guard == NULL) {
+        return (LFL_ERR);
+    }
+
+    for (;;) {
+        LFLNode *curr = helper_ptr(atomic_load_explicit(&list->head, memory_order_acquire));
+
+        if (curr == NULL) {
+            ebr_exit(guard);
+            return (LFL_ERR);
+        }
+
+        uintptr_t succ = atomic_load_explicit(&curr->next, memory_order_acquire);
+
+        if (helper_is_marked(succ)) {
+            helper_unlink(guard, &list->head, curr, succ);
+            continue ;
+        }
+
+        if (!atomic_compare_exchange_strong_explicit(&curr->next, &succ, succ | MARK,
+            memory_order_acq_rel, memory_order_relaxed)) {
+            continue ;
+        }
+
+        if (out != NULL) {
+            memcpy(out, curr->data, list->elem_size);
+        }
+
+        atomic_fetch_sub_explicit(&list->size, 1, memory_order_relaxed);
+        helper_unlink(guard, &list->head, curr, succ);
+        ebr_exit(guard);
+        return (LFL_OK);
+    }
+}
+
+int lfl_insert(LockFreeList *list, const void *elem) {
+    if (list == NULL || elem == NULL || list->cmp == NULL) {
+        return (LFL_ERR);
+    }
+
+    LFLNode *node = helper_new_node(list, elem);
+
+    if (node == NULL) {
+        return (LFL_ERR);
+    }
+
+    EpochGuard *guard = ebr_enter(list->domain);
+
+    if (guard == NULL) {
+        free(node);
+        return (LFL_ERR);
+    }
+
+    for (;;) {
+        _Atomic uintptr_t *prev;
+        LFLNode *curr = helper_search(list, guard, elem, &prev);
+        uintptr_t expected = (uintptr_t)curr;
+
+        atomic_store_explicit(&node->next, expected, memory_order_relaxed);
+
+        /* fails if `prev` changed or its node got marked */
+        if (atomic_compare_exchange_strong_explicit(prev, &expected, (uintptr_t)node,
+            memory_order_release, memory_order_relaxed)) {
+            break ;
+        }
+    }
+
+    atomic_fetch_add_explicit(&list->size, 1, memory_order_relaxed);
+    ebr_exit(guard);
+    return (LFL_OK);
+}
+
+int lfl_erase(LockFreeList *list, const void *key) {
+    if (list == NULL || key == NULL || list->cmp == NULL) {
+        return (LFL_ERR);
+    }
+
+    EpochGuard *guard = ebr_enter(list->domain);
+
+    if (guard == NULL) {
+        return (LFL_ERR);
+    }
+
+    for (;;) {
+        _Atomic uintptr_t *prev;
+        LFLNode *curr = helper_search(list, guard, key, &prev);
+
+        if (curr == NULL || list->cmp(curr->data, key) != 0) {
+            ebr_exit(guard);
+            return (LFL_ERR);
+        }
+
+        uintptr_t succ = atomic_load_explicit(&curr->next, memory_order_acquire);
+
+        if (helper_is_marked(succ)
+            || !atomic_compare_exchange_strong_explicit(&curr->next, &succ, succ | MARK,
+                memory_order_acq_rel, memory_order_relaxed)) {
+            continue ;
+        }
+
+        atomic_fetch_sub_explicit(&list->size, 1, memory_order_relaxed);
+
+        /* on a lost race, a search cleans it up (it lies before the first node >= key) */
+        if (!helper_unlink(guard, prev, curr, succ)) {
+            helper_search(list, guard, key, &prev);
+        }
+
+        ebr_exit(guard);
+        return (LFL_OK);
+    }
+}
+
+
+/* lookup */
+
+int lfl_find(LockFreeList *list, const void *key, void *out) {
+    if (list == NULL || key == NULL || list->cmp == NULL) {
+        return (LFL_ERR);
+    }
+
+    EpochGuard *guard = ebr_enter(list->domain);
+
+    if (guard == NULL) {
+        return (LFL_ERR);
+    }
+
+    _Atomic uintptr_t *prev;
+    LFLNode *curr = helper_search(list, guard, key, &prev);
+    int found = curr != NULL && list->cmp(curr->data, key) == 0;
+
+    if (found && out != NULL) {
+        memcpy(out, curr->data, list->elem_size);
+    }
+
+    ebr_exit(guard);
+    return (found ? LFL_OK : LFL_ERR);
+}
+
+size_t lfl_size(const LockFreeList *list) {
+    if (list == NULL) {
+        return (0);
+    }
+
+    return (atomic_load_explicit(&((LockFreeList *)list)->size, memory_order_relaxed));
+}
+
+int lfl_is_empty(const LockFreeList *list) {
+    return (lfl_size(list) == 0);
+}
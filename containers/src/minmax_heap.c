@@ -0,0 +1,285 @@
+// implemented interface
+# include "minmax_heap.h"
+
+// implementation dependencies
+# include "dynamic_array.h"
+# include <stdlib.h>
+# include <string.h>
+
+# define INITIAL_CAPACITY 1024
+
+/*
+** min levels are the even ones (the root is on level 0), max levels the odd ones
+** the sift loops carry the moving element aside and copy one element per
+** step into the hole, like the ones of heap.c
+*/
+typedef struct MinMaxHeap {
+    DynamicArray *arr;
+    heap_cmp_fn cmp;
+    size_t elem_size;
+    void *moving;   // element carried by the sift loops
+    void *spare;    // element swapped out of a parent by trickle-down
+} MinMaxHeap;
+
+/* private helpers */
+
+static inline void helper_copy(void *dst, const void *src, size_t elem_size) {
+    switch (elem_size) {
+        case 4:
+            memcpy(dst, src, 4);
+            break ;
+        case 8:
+            memcpy(dst, src, 8);
+            break ;
+        case 16:
+            memcpy(dst, src, 16);
+            break ;
+        default:
+            memcpy(dst, src, elem_size);
+            break ;
+    }
+}
+
+static inline int helper_on_min_level(size_t i) {
+    size_t level = 0;
+
+    for (size_t v = i + 1; v > 1; v >>= 1) {
+        ++level;
+    }
+
+    return (level % 2 == 0);
+}
+
+/* whether `a` goes before `b` towards the root: smaller on min levels, larger on max levels */
+static inline int helper_before(const MinMaxHeap *mmh, const void *a, const void *b, int min_level) {
+    int c = mmh->cmp(a, b);
+
+    return (min_level ? c < 0 : c > 0);
+}
+
+/* moves `elem` up from the hole at `i` through the grandparents of its kind of level */
+static size_t helper_bubble_up(MinMaxHeap *mmh, unsigned char *base, size_t i, const void *elem, int min_level) {
+    size_t es = mmh->elem_size;
+
+    while (i > 2) {
+        size_t grand_i = ((i - 1) / 2 - 1) / 2;
+
+        if (!helper_before(mmh, elem, base + grand_i * es, min_level)) {
+            break ;
+        }
+
+        helper_copy(base + i * es, base + grand_i * es, es);
+        i = grand_i;
+    }
+
+    return (i);
+}
+
+/* places `elem` into the hole at the end of the array */
+static void helper_sift_up(MinMaxHeap *mmh, size_t i, const void *elem) {
+    unsigned char *base = da_data(mmh->arr);
+    size_t es = mmh->elem_size;
+    int min_level = helper_on_min_level(i);
+
+    if (i > 0) {
+        size_t parent_i = (i - 1) / 2;
+
+        /* on the wrong side of its parent: it belongs to the other kind of level */
+        if (helper_before(mmh, base + parent_i * es, elem, min_level)) {
+            helper_copy(base + i * es, base + parent_i * es, es);
+            i = parent_i;
+            min_level = !min_level;
+        }
+
+        i = helper_bubble_up(mmh, base, i, elem, min_level);
+    }
+
+    helper_copy(base + i * es, elem, es);
+}
+
+/*
+** moves `elem` (held in mmh->moving) down from the hole at `i`, along the best
+** of the children and grandchildren of each node (the smallest ones below a
+** min level node, the largest below a max level one)
+** when it takes the place of a grandchild, it may be on the wrong side of
+** that grandchild's parent (of the other kind of level): then the two are
+** exchanged, and the parent's element carries on down instead
+*/
+static void helper_trickle_down(MinMaxHeap *mmh, size_t i) {
+    unsigned char *base = da_data(mmh->arr);
+    size_t es = mmh->elem_size;
+    size_t size = da_size(mmh->arr);
+    int min_level = helper_on_min_level(i);
+    void *elem = mmh->moving;
+
+    while (2 * i + 1 < size) {
+        size_t best_i = 2 * i + 1;
+
+        /* children 2i + 1, 2i + 2, then grandchildren 4i + 3 .. 4i + 6 */
+        if (2 * i + 2 < size && helper_before(mmh, base + (2 * i + 2) * es, base + best_i * es, min_level)) {
+            best_i = 2 * i + 2;
+        }
+        for (size_t g = 4 * i + 3; g <= 4 * i + 6 && g < size; ++g) {
+            if (helper_before(mmh, base + g * es, base + best_i * es, min_level)) {
+                best_i = g;
+            }
+        }
+
+        if (!helper_before(mmh, base + best_i * es, elem, min_level)) {
+            break ;
+        }
+
+        int grandchild = best_i > 2 * i + 2;
+
+        helper_copy(base + i * es, base + best_i * es, es);
+        i = best_i;
+
+        /* a child is on the other kind of level, and has no better descendant */
+        if (!grandchild) {
+            break ;
+        }
+
+        size_t parent_i = (i - 1) / 2;
+
+        if (helper_before(mmh, base + parent_i * es, elem, min_level)) {
+            /* exchange with the parent: the parent's element goes on down */
+            helper_copy(mmh->spare, base + parent_i * es, es);
+            helper_copy(base + parent_i * es, elem, es);
+            helper_copy(elem, mmh->spare, es);
+        }
+    }
+
+    helper_copy(base + i * es, elem, es);
+}
+
+/* removes the element at `i` (the root or the max child of the root) */
+static int helper_remove_at(MinMaxHeap *mmh, size_t i) {
+    size_t size = da_size(mmh->arr);
+
+    if (size == 0) {
+        return (MMH_ERR);
+    }
+
+    /* the last element fills the hole */
+    helper_copy(mmh->moving, da_get(mmh->arr, size - 1), mmh->elem_size);
+
+    if (da_pop(mmh->arr) == DA_ERR) {
+        return (MMH_ERR);
+    }
+
+    if (i < size - 1) {
+        helper_trickle_down(mmh, i);
+    }
+
+    return (MMH_OK);
+}
+
+/* index of the largest element (size > 0) */
+static size_t helper_max_index(const MinMaxHeap *mmh) {
+    size_t size = da_size(mmh->arr);
+
+    if (size <= 2) {
+        return (size - 1);
+    }
+
+    const unsigned char *base = da_data(mmh->arr);
+    size_t es = mmh->elem_size;
+
+    return ((mmh->cmp(base + 2 * es, base + es) > 0) ? 2 : 1);
+}
+
+MinMaxHeap *mmh_create(size_t elem_size, heap_cmp_fn cmp) {
+    if (elem_size == 0 || cmp == NULL) {
+        return (NULL);
+    }
+
+    MinMaxHeap *mmh = malloc(sizeof(MinMaxHeap));
+
+    if (mmh == NULL) {
+        return (NULL);
+    }
+
+    mmh->arr = da_create(INITIAL_CAPACITY, elem_size);
+    mmh->moving = malloc(elem_size);
+    mmh->spare = malloc(elem_size);
+
+    if (mmh->arr == NULL || mmh->moving == NULL || mmh->spare == NULL) {
+        mmh_destroy(mmh);
+        return (NULL);
+    }
+
+    mmh->cmp = cmp;
+    mmh->elem_size = elem_size;
+
+    return (mmh);
+}
+
+void mmh_destroy(MinMaxHeap *mmh) {
+    if (mmh != NULL) {
+        da_destroy(mmh->arr);
+        free(mmh->moving);
+        free(mmh->spare);
+        free(mmh);
+    }
+}
+
+int mmh_insert(MinMaxHeap *mmh, const void *elem) {
+    if (mmh == NULL || elem == NULL) {
+        return (MMH_ERR);
+    }
+
+    /* `elem` may point into the buffer, which the push can move */
+    helper_copy(mmh->moving, elem, mmh->elem_size);
+
+    if (da_push_back(mmh->arr, mmh->moving) == DA_ERR) {
+        return (MMH_ERR);
+    }
+
+    helper_sift_up(mmh, da_size(mmh->arr) - 1, mmh->moving);
+
+    return (MMH_OK);
+}
+
+int mmh_pop_min(MinMaxHeap *mmh) {
+    if (mmh == NULL) {
+        return (MMH_ERR);
+    }
+
+    return (helper_remove_at(mmh, 0));
+}
+
+int mmh_pop_max(MinMaxHeap *mmh) {
+    if (mmh == NULL || da_size(mmh->arr) == 0) {
+        return (MMH_ERR);
+    }
+
+    return (helper_remove_at(mmh, helper_max_index(mmh)));
+}
+
+void *mmh_peek_min(const MinMaxHeap *mmh) {
+    if (mmh == NULL) {
+        return (NULL);
+    }
+
+    return (da_get(mmh->arr, 0));
+}
+
+void *mmh_peek_max(const MinMaxHeap *mmh) {
+    if (mmh == NULL || da_size(mmh->arr) == 0) {
+        return (NULL);
+    }
+
+    return (da_get(mmh->arr, helper_max_index(mmh)));
+}
+
+size_t mmh_size(const MinMaxHeap *mmh) {
+    if (mmh == NULL) {
+        return (0);
+    }
+
+    return (da_size(mmh->arr));
+}
+
+int mmh_is_empty(const MinMaxHeap *mmh) {
+    return (mmh == NULL || mmh_size(mmh) == 0);
+}
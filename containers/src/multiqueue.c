@@ -0,0 +1,275 @@
+/* implemented interface */
+# include "multiqueue.h"
+
+/* implementation dependencies */
+# include <stdlib.h>
+# include <stdint.h>
+# include <string.h>
+# include <stdalign.h>
+# include <stdatomic.h>
+# include <pthread.h>
+
+# define CACHE_LINE 64
+# define PUSH_TRIES 4   // random queues tried without blocking before push waits for a lock
+
+/* one internal queue per cache line, so that the threads working on different queues don't share lines */
+typedef struct MQSlot {
+    alignas(CACHE_LINE) pthread_mutex_t lock;
+    PriorityQueue *pq;
+    _Atomic size_t size;    // copy of pq_size, readable without the lock
+} MQSlot;
+
+/* private data */
+typedef struct MultiQueue {
+    MQSlot *slots;
+    size_t nqueues;
+    size_t elem_size;
+    pq_cmp_fn cmp;
+} MultiQueue;
+
+/* xorshift state of the current thread, seeded on first use */
+static _Thread_local uint64_t tls_seed = 0;
+static _Atomic uint64_t seed_counter = 0;
+
+
+/* helpers */
+
+static size_t helper_random(void) {
+    if (tls_seed == 0) {
+        /* splitmix64 step on a per-thread counter: distinct, non-zero seeds */
+        uint64_t z = atomic_fetch_add_explicit(&seed_counter, 1, memory_order_relaxed) + 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        tls_seed = (z ^ (z >> 31)) | 1;
+    }
+
+    tls_seed ^= tls_seed << 13;
+    tls_seed ^= tls_seed >> 7;
+    tls_seed ^= tls_seed << 17;
+
+    return ((size_t)tls_seed);
+}
+
+/* pops the top of a locked slot into `out` */
+static void helper_take(MultiQueue *mq, MQSlot *slot, void *out) {
+    memcpy(out, pq_top(slot->pq), mq->elem_size);
+    pq_pop(slot->pq);
+    atomic_store_explicit(&slot->size, pq_size(slot->pq), memory_order_relaxed);
+}
+
+/*
+** one attempt at the better top of two random queues
+** both locks are only tried, never waited for (no lock order to respect,
+** and a busy queue is just skipped)
+** return MQ_OK if an element was taken, MQ_ERR otherwise
+*/
+static int helper_try_pop_two(MultiQueue *mq, void *out) {
+    size_t a = helper_random() % mq->nqueues;
+    size_t b = (a + 1 + helper_random() % (mq->nqueues - 1)) % mq->nqueues;
+    MQSlot *sa = &mq->slots[a];
+    MQSlot *sb = &mq->slots[b];
+
+    /* cheap filter on the unlocked sizes */
+    int has_a = atomic_load_explicit(&sa->size, memory_order_relaxed) > 0;
+    int has_b = atomic_load_explicit(&sb->size, memory_order_relaxed) > 0;
+
+    if (!has_a && !has_b) {
+        return (MQ_ERR);
+    }
+    if (!has_a || !has_b) {
+        MQSlot *s = has_a ? sa : sb;
+
+        if (pthread_mutex_trylock(&s->lock) != 0) {
+            return (MQ_ERR);
+        }
+
+        int status = MQ_ERR;
+
+        if (!pq_is_empty(s->pq)) {
+            helper_take(mq, s, out);
+            status = MQ_OK;
+        }
+
+        pthread_mutex_unlock(&s->lock);
+        return (status);
+    }
+
+    if (pthread_mutex_trylock(&sa->lock) != 0) {
+        return (MQ_ERR);
+    }
+    if (pthread_mutex_trylock(&sb->lock) != 0) {
+        pthread_mutex_unlock(&sa->lock);
+        return (MQ_ERR);
+    }
+
+    void *top_a = pq_top(sa->pq);
+    void *top_b = pq_top(sb->pq);
+    MQSlot *best = NULL;
+
+    if (top_a != NULL && (top_b == NULL || mq->cmp(top_a, top_b) <= 0)) {
+        best = sa;
+    } else if (top_b != NULL) {
+        best = sb;
+    }
+
+    if (best != NULL) {
+        helper_take(mq, best, out);
+    }
+
+    pthread_mutex_unlock(&sb->lock);
+    pthread_mutex_unlock(&sa->lock);
+
+    return (best != NULL ? MQ_OK : MQ_ERR);
+}
+
+/* waits for every queue in turn, from a random one, and pops the first top found */
+static int helper_pop_scan(MultiQueue *mq, void *out) {
+    size_t start = helper_random() % mq->nqueues;
+
+    for (size_t i = 0; i < mq->nqueues; ++i) {
+        MQSlot *s = &mq->slots[(start + i) % mq->nqueues];
+
+        if (atomic_load_explicit(&s->size, memory_order_relaxed) == 0) {
+            continue ;
+        }
+
+        pthread_mutex_lock(&s->lock);
+
+        if (!pq_is_empty(s->pq)) {
+            helper_take(mq, s, out);
+            pthread_mutex_unlock(&s->lock);
+            return (MQ_OK);
+        }
+
+        pthread_mutex_unlock(&s->lock);
+    }
+
+    return (MQ_ERR);
+}
+
+
+/* constructor / destructor */
+
+MultiQueue *mq_create(size_t elem_size, pq_cmp_fn cmp, size_t nqueues) {
+    if (elem_size == 0 || cmp == NULL || nqueues < 2 || nqueues > SIZE_MAX / sizeof(MQSlot)) {
+        return (NULL);
+    }
+
+    MultiQueue *mq = malloc(sizeof(MultiQueue));
+
+    if (mq == NULL) {
+        return (NULL);
+    }
+
+    /* sizeof(MQSlot) is a multiple of CACHE_LINE, as aligned_alloc requires */
+    mq->slots = aligned_alloc(CACHE_LINE, nqueues * sizeof(MQSlot));
+
+    if (mq->slots == NULL) {
+        free(mq);
+        return (NULL);
+    }
+
+    mq->nqueues = 0;
+    mq->elem_size = elem_size;
+    mq->cmp = cmp;
+
+    for (size_t i = 0; i < nqueues; ++i) {
+        MQSlot *s = &mq->slots[i];
+
+        s->pq = pq_create(elem_size, cmp);
+
+        if (s->pq == NULL || pthread_mutex_init(&s->lock, NULL) != 0) {
+            pq_destroy(s->pq);
+            mq_destroy(mq);
+            return (NULL);
+        }
+
+        atomic_init(&s->size, 0);
+        mq->nqueues++;
+    }
+
+    return (mq);
+}
+
+void mq_destroy(MultiQueue *mq) {
+    if (mq == NULL) {
+        return ;
+    }
+
+    for (size_t i = 0; i < mq->nqueues; ++i) {
+        pthread_mutex_destroy(&mq->slots[i].lock);
+        pq_destroy(mq->slots[i].pq);
+    }
+
+    free(mq->slots);
+    free(mq);
+}
+
+
+/* modifiers */
+
+int mq_push(MultiQueue *mq, const void *elem) {
+    if (mq == NULL || elem == NULL) {
+        return (MQ_ERR);
+    }
+
+    MQSlot *s = NULL;
+
+    for (size_t i = 0; i < PUSH_TRIES; ++i) {
+        s = &mq->slots[helper_random() % mq->nqueues];
+
+        if (pthread_mutex_trylock(&s->lock) == 0) {
+            break ;
+        }
+        s = NULL;
+    }
+
+    /* every queue tried was busy: wait for a last random one */
+    if (s == NULL) {
+        s = &mq->slots[helper_random() % mq->nqueues];
+        pthread_mutex_lock(&s->lock);
+    }
+
+    int status = pq_push(s->pq, elem);
+
+    atomic_store_explicit(&s->size, pq_size(s->pq), memory_order_relaxed);
+    pthread_mutex_unlock(&s->lock);
+
+    return (status == PQ_OK ? MQ_OK : MQ_ERR);
+}
+
+int mq_pop(MultiQueue *mq, void *out) {
+    if (mq == NULL || out == NULL) {
+        return (MQ_ERR);
+    }
+
+    /* as many random attempts as queues, then one full scan */
+    for (size_t i = 0; i < mq->nqueues; ++i) {
+        if (helper_try_pop_two(mq, out) == MQ_OK) {
+            return (MQ_OK);
+        }
+    }
+
+    return (helper_pop_scan(mq, out));
+}
+
+
+/* lookup */
+
+size_t mq_size(const MultiQueue *mq) {
+    if (mq == NULL) {
+        return (0);
+    }
+
+    size_t size = 0;
+
+    for (size_t i = 0; i < mq->nqueues; ++i) {
+        size += atomic_load_explicit(&mq->slots[i].size, memory_order_relaxed);
+    }
+
+    return (size);
+}
+
+int mq_is_empty(const MultiQueue *mq) {
+    return (mq_size(mq) == 0);
+}
@@ -0,0 +1,296 @@
+// implemented interface
+# include "pairing_heap.h"
+
+// implementation dependencies
+# include "pool_allocator.h"
+# include <stdlib.h>
+# include <string.h>
+# include <stdint.h>
+# include <stdalign.h>
+
+/*
+** `prev` is the parent for a first child, the previous sibling otherwise
+** (NULL for the root), so a node can be cut out in O(1)
+*/
+typedef struct PHNode {
+    struct PHNode *child;     // first child
+    struct PHNode *sibling;   // next sibling
+    struct PHNode *prev;
+    alignas(max_align_t) unsigned char data[];
+} PHNode;
+
+/* private data */
+typedef struct PairingHeap {
+    PHNode *root;
+    size_t size;
+    size_t elem_size;
+    heap_cmp_fn cmp;
+    PoolAllocator *pool;
+} PairingHeap;
+
+
+/* helpers */
+
+/* links two roots: the one with the lower priority becomes the first child of the other */
+/* on ties `a` stays on top, returns the new root (its `sibling` and `prev` are left as they were) */
+static PHNode *helper_link(const PairingHeap *ph, PHNode *a, PHNode *b) {
+    if (ph->cmp(b->data, a->data) < 0) {
+        PHNode *tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    b->sibling = a->child;
+    if (a->child != NULL) {
+        a->child->prev = b;
+    }
+    b->prev = a;
+    a->child = b;
+
+    return (a);
+}
+
+/*
+** two-pass pairing of a sibling list: left to right, siblings are linked by
+** pairs (the results are stacked in reverse order), then the stack is
+** melded from the rightmost pair back to the left
+*/
+static PHNode *helper_combine(const PairingHeap *ph, PHNode *first) {
+    if (first == NULL) {
+        return (NULL);
+    }
+
+    PHNode *pairs = NULL;
+
+    while (first != NULL) {
+        PHNode *a = first;
+        PHNode *b = a->sibling;
+        PHNode *merged = a;
+
+        first = NULL;
+        if (b != NULL) {
+            first = b->sibling;
+            merged = helper_link(ph, a, b);
+        }
+
+        merged->sibling = pairs;
+        pairs = merged;
+    }
+
+    PHNode *root = pairs;
+
+    pairs = pairs->sibling;
+    while (pairs != NULL) {
+        PHNode *next = pairs->sibling;
+        root = helper_link(ph, root, pairs);
+        pairs = next;
+    }
+
+    root->sibling = NULL;
+    root->prev = NULL;
+
+    return (root);
+}
+
+/* cuts `node` (not the root) and its subtree out of its sibling list */
+static void helper_cut(PHNode *node) {
+    if (node->prev->child == node) {
+        node->prev->child = node->sibling;
+    } else {
+        node->prev->sibling = node->sibling;
+    }
+
+    if (node->sibling != NULL) {
+        node->sibling->prev = node->prev;
+    }
+
+    node->sibling = NULL;
+    node->prev = NULL;
+}
+
+/*
+** visits every node of the tree under `root` once, in O(n) and without a
+** stack: the children of the visited node are pushed in front of the nodes
+** left to visit (its child list is walked once to reach its last sibling)
+** `fn` may free the node it is given
+*/
+static int helper_for_each(PHNode *root, int (*fn)(PHNode *node, void *arg), void *arg) {
+    PHNode *todo = root;
+
+    while (todo != NULL) {
+        PHNode *node = todo;
+
+        todo = node->sibling;
+        if (node->child != NULL) {
+            PHNode *last = node->child;
+
+            while (last->sibling != NULL) {
+                last = last->sibling;
+            }
+            last->sibling = todo;
+            todo = node->child;
+        }
+
+        if (fn(node, arg) == PH_ERR) {
+            return (PH_ERR);
+        }
+    }
+
+    return (PH_OK);
+}
+
+static int helper_free_node(PHNode *node, void *pool) {
+    pool_free(pool, node);
+    return (PH_OK);
+}
+
+/* constructor / destructor */
+
+PairingHeap *ph_create(size_t elem_size, heap_cmp_fn cmp) {
+    if (elem_size == 0 || cmp == NULL || elem_size > SIZE_MAX - sizeof(PHNode)) {
+        return (NULL);
+    }
+
+    PairingHeap *ph = malloc(sizeof(PairingHeap));
+
+    if (ph == NULL) {
+        return (NULL);
+    }
+
+    ph->pool = pool_create(sizeof(PHNode) + elem_size);
+
+    if (ph->pool == NULL) {
+        free(ph);
+        return (NULL);
+    }
+
+    ph->root = NULL;
+    ph->size = 0;
+    ph->elem_size = elem_size;
+    ph->cmp = cmp;
+
+    return (ph);
+}
+
+void ph_destroy(PairingHeap *ph) {
+    if (ph == NULL) {
+        return ;
+    }
+
+    /* a pool of its own goes away with all its nodes at once */
+    if (pool_is_shared(ph->pool)) {
+        helper_for_each(ph->root, helper_free_node, ph->pool);
+    }
+
+    pool_destroy(ph->pool);
+    free(ph);
+}
+
+
+/* modifiers */
+
+PHNode *ph_insert(PairingHeap *ph, const void *elem) {
+    if (ph == NULL || elem == NULL) {
+        return (NULL);
+    }
+
+    PHNode *node = pool_alloc(ph->pool);
+
+    if (node == NULL) {
+        return (NULL);
+    }
+
+    memcpy(node->data, elem, ph->elem_size);
+    node->child = NULL;
+    node->sibling = NULL;
+    node->prev = NULL;
+
+    ph->root = (ph->root == NULL) ? node : helper_link(ph, ph->root, node);
+    ph->size++;
+
+    return (node);
+}
+
+int ph_remove_top(PairingHeap *ph) {
+    if (ph == NULL || ph->root == NULL) {
+        return (PH_ERR);
+    }
+
+    PHNode *old = ph->root;
+
+    ph->root = helper_combine(ph, old->child);
+    ph->size--;
+    pool_free(ph->pool, old);
+
+    return (PH_OK);
+}
+
+int ph_decrease_key(PairingHeap *ph, PHNode *node, const void *elem) {
+    if (ph == NULL || node == NULL || elem == NULL || ph->cmp(elem, node->data) > 0) {
+        return (PH_ERR);
+    }
+
+    /* memmove: `elem` may be the node's own value */
+    memmove(node->data, elem, ph->elem_size);
+
+    if (node != ph->root) {
+        helper_cut(node);
+        ph->root = helper_link(ph, ph->root, node);
+    }
+
+    return (PH_OK);
+}
+
+int ph_meld(PairingHeap *dst, PairingHeap *src) {
+    if (dst == NULL || src == NULL || dst->elem_size != src->elem_size) {
+        return (PH_ERR);
+    }
+
+    if (dst == src || src->root == NULL) {
+        return (PH_OK);
+    }
+
+    /* src's nodes stay where they are: its pool joins dst's in O(1), and both */
+    /* heaps allocate from the joined pool from then on (same element size, same blocks) */
+    if (dst->pool != src->pool && pool_absorb(dst->pool, src->pool) != POOL_OK) {
+        return (PH_ERR);
+    }
+
+    dst->root = (dst->root == NULL) ? src->root : helper_link(dst, dst->root, src->root);
+    dst->size += src->size;
+    src->root = NULL;
+    src->size = 0;
+
+    return (PH_OK);
+}
+
+
+/* lookup */
+
+void *ph_peek(const PairingHeap *ph) {
+    if (ph == NULL || ph->root == NULL) {
+        return (NULL);
+    }
+
+    return (ph->root->data);
+}
+
+void *ph_value(const PHNode *node) {
+    if (node == NULL) {
+        return (NULL);
+    }
+
+    return ((void *)node->data);
+}
+
+size_t ph_size(const PairingHeap *ph) {
+    if (ph == NULL) {
+        return (0);
+    }
+
+    return (ph->size);
+}
+
+int ph_is_empty(const PairingHeap *ph) {
+    return (ph == NULL || ph->root == NULL);
+}
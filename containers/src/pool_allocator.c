@@ -0,0 +1,390 @@
+/* implemented interface */
+# include "pool_allocator.h"
+
+/* implementation dependencies */
+# include <stdlib.h>
+# include <stdint.h>
+# include <stdalign.h>
+
+# define FIRST_SLAB_BLOCKS 16       // blocks in the first slab
+# define MAX_SLAB_BYTES (1 << 20)   // slabs stop doubling past this size
+
+/* slab header, blocks follow it contiguously */
+typedef struct PoolSlab {
+    struct PoolSlab *next;  // older slab
+    size_t nblocks;         // number of blocks carved from this slab
+    alignas(max_align_t) unsigned char blocks[];
+} PoolSlab;
+
+/* a free block stores the link to the next free block in its first bytes */
+typedef struct PoolBlock {
+    struct PoolBlock *next;
+} PoolBlock;
+
+/*
+** private data
+**
+** pools joined by pool_absorb form a tree: the absorbed one keeps no memory
+** and forwards every call to the pool that took its slabs (it holds a
+** reference on it), so the handles of both stay valid and allocate from the
+** same blocks; the root of the tree is found by following `forward`
+*/
+typedef struct PoolAllocator {
+    size_t block_size;          // rounded up to keep every block aligned
+    size_t next_slab_blocks;    // size of the next slab (doubles up to MAX_SLAB_BYTES)
+    PoolSlab *slabs;            // newest slab first
+    PoolSlab *slabs_tail;       // oldest slab (valid when slabs isn't NULL)
+    unsigned char *bump;        // first never-used block of the newest slab
+    unsigned char *bump_end;    // end of the newest slab
+    PoolBlock *free_list;       // recycled blocks
+    PoolBlock *free_tail;       // last recycled block (valid when free_list isn't NULL)
+    size_t refs;                // owners sharing the pool (absorbed pools included)
+    struct PoolAllocator *forward; // pool holding the memory once absorbed, NULL for a root
+} PoolAllocator;
+
+
+/* helpers */
+
+/* the pool actually holding the memory, for the read-only entry points */
+static const PoolAllocator *helper_root_const(const PoolAllocator *pool) {
+    while (pool->forward != NULL) {
+        pool = pool->forward;
+    }
+
+    return (pool);
+}
+
+/* the pool actually holding the memory, `pool` is pointed straight at it for the next calls */
+static PoolAllocator *helper_root(PoolAllocator *pool) {
+    PoolAllocator *root = (PoolAllocator *)helper_root_const(pool);
+
+    if (pool->forward != NULL && pool->forward != root) {
+        PoolAllocator *old = pool->forward;
+
+        root->refs++;
+        pool->forward = root;
+        pool_destroy(old);
+    }
+
+    return (root);
+}
+
+/* allocates a new slab of `nblocks` blocks in front of the others and makes it the bump region */
+/* return NULL to indicate failure */
+static PoolSlab *helper_new_slab(PoolAllocator *pool, size_t nblocks) {
+    if (nblocks > (SIZE_MAX - sizeof(PoolSlab)) / pool->block_size) {
+        return (NULL);
+    }
+
+    PoolSlab *slab = malloc(sizeof(PoolSlab) + nblocks * pool->block_size);
+
+    if (slab == NULL) {
+        return (NULL);
+    }
+
+    slab->nblocks = nblocks;
+    slab->next = pool->slabs;
+    if (pool->slabs == NULL) {
+        pool->slabs_tail = slab;
+    }
+    pool->slabs = slab;
+    pool->bump = slab->blocks;
+    pool->bump_end = slab->blocks + nblocks * pool->block_size;
+
+    /* grow geometrically so big pools need few slabs (and few libc calls) */
+    while (pool->next_slab_blocks <= nblocks && pool->next_slab_blocks * pool->block_size < MAX_SLAB_BYTES) {
+        pool->next_slab_blocks *= 2;
+    }
+
+    return (slab);
+}
+
+
+/* constructor / destructor */
+
+/* block_size must be greater than 0 */
+/* return NULL to indicate construction failure */
+PoolAllocator *pool_create(size_t block_size) {
+    size_t align = alignof(max_align_t);
+
+    if (block_size == 0 || block_size > SIZE_MAX - align) {
+        return (NULL);
+    }
+
+    PoolAllocator *pool = malloc(sizeof(PoolAllocator));
+
+    if (pool == NULL) {
+        return (NULL);
+    }
+
+    /* a free block must be able to hold the free list link */
+    if (block_size < sizeof(PoolBlock)) {
+        block_size = sizeof(PoolBlock);
+    }
+
+    pool->block_size = (block_size + align - 1) / align * align;
+    pool->next_slab_blocks = FIRST_SLAB_BLOCKS;
+    pool->slabs = NULL;
+    pool->slabs_tail = NULL;
+    pool->bump = NULL;
+    pool->bump_end = NULL;
+    pool->free_list = NULL;
+    pool->free_tail = NULL;
+    pool->refs = 1;
+    pool->forward = NULL;
+
+    return (pool);
+}
+
+/* drops one reference, the last owner releases the memory */
+void pool_destroy(PoolAllocator *pool) {
+    if (pool == NULL) {
+        return ;
+    }
+
+    if (--pool->refs > 0) {
+        return ;
+    }
+
+    /* an absorbed pool only holds a reference on the one that took its memory */
+    if (pool->forward != NULL) {
+        pool_destroy(pool->forward);
+        free(pool);
+        return ;
+    }
+
+    PoolSlab *slab = pool->slabs;
+
+    while (slab != NULL) {
+        PoolSlab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+
+    free(pool);
+}
+
+
+/* allocation */
+
+void *pool_alloc(PoolAllocator *pool) {
+    if (pool == NULL) {
+        return (NULL);
+    }
+
+    pool = helper_root(pool);
+
+    /* recycled blocks first */
+    if (pool->free_list != NULL) {
+        PoolBlock *block = pool->free_list;
+        pool->free_list = block->next;
+        return (block);
+    }
+
+    /* then the untouched part of the newest slab */
+    if (pool->bump == pool->bump_end && helper_new_slab(pool, pool->next_slab_blocks) == NULL) {
+        return (NULL);
+    }
+
+    void *block = pool->bump;
+    pool->bump += pool->block_size;
+
+    return (block);
+}
+
+/* a slab big enough for all of them replaces the bump region if the current one is too small */
+int pool_reserve(PoolAllocator *pool, size_t nblocks) {
+    if (pool == NULL) {
+        return (POOL_ERR);
+    }
+
+    pool = helper_root(pool);
+
+    if ((size_t)(pool->bump_end - pool->bump) / pool->block_size >= nblocks) {
+        return (POOL_OK);
+    }
+
+    if (nblocks < pool->next_slab_blocks) {
+        nblocks = pool->next_slab_blocks;
+    }
+
+    if (helper_new_slab(pool, nblocks) == NULL) {
+        return (POOL_ERR);
+    }
+
+    return (POOL_OK);
+}
+
+void pool_free(PoolAllocator *pool, void *block) {
+    if (pool == NULL || block == NULL) {
+        return ;
+    }
+
+    pool = helper_root(pool);
+
+    PoolBlock *b = block;
+
+    if (pool->free_list == NULL) {
+        pool->free_tail = b;
+    }
+
+    b->next = pool->free_list;
+    pool->free_list = b;
+}
+
+/* after this call every block is free, only the newest slab is kept */
+/* a shared pool is left untouched: the other owners may still use their blocks */
+void pool_clear(PoolAllocator *pool) {
+    if (pool == NULL || pool_is_shared(pool)) {
+        return ;
+    }
+
+    pool = helper_root(pool);
+
+    if (pool->slabs == NULL) {
+        return ;
+    }
+
+    PoolSlab *keep = pool->slabs;
+    PoolSlab *slab = keep->next;
+
+    while (slab != NULL) {
+        PoolSlab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+
+    keep->next = NULL;
+    pool->slabs_tail = keep;
+    pool->bump = keep->blocks;
+    pool->bump_end = keep->blocks + keep->nblocks * pool->block_size;
+    pool->free_list = NULL;
+    pool->free_tail = NULL;
+}
+
+
+/* sharing */
+
+PoolAllocator *pool_share(PoolAllocator *pool) {
+    if (pool == NULL) {
+        return (NULL);
+    }
+
+    pool->refs++;
+    return (pool);
+}
+
+/* the memory has a single owner when nothing but `pool` leads to its root */
+int pool_is_shared(const PoolAllocator *pool) {
+    if (pool == NULL) {
+        return (0);
+    }
+
+    for (; pool != NULL; pool = pool->forward) {
+        if (pool->refs > 1) {
+            return (1);
+        }
+    }
+
+    return (0);
+}
+
+/* moves every slab and free block of src's root into dst's root, which src forwards to from now on */
+/* cost: O(1), the slab lists and the free lists are joined through their tails */
+int pool_absorb(PoolAllocator *dst, PoolAllocator *src) {
+    if (dst == NULL || src == NULL || dst == src || dst->block_size != src->block_size) {
+        return (POOL_ERR);
+    }
+
+    dst = helper_root(dst);
+    src = helper_root(src);
+
+    if (dst == src) {
+        return (POOL_OK);
+    }
+
+    /* every handle on src's memory now reaches it through dst */
+    src->forward = dst;
+    dst->refs++;
+
+    if (src->slabs == NULL) {
+        return (POOL_OK);
+    }
+
+    /* the slab with the larger untouched region goes first and becomes the bump region */
+    PoolSlab *first = dst->slabs;
+    PoolSlab *second = src->slabs;
+
+    if ((size_t)(src->bump_end - src->bump) > (size_t)(dst->bump_end - dst->bump)) {
+        first = src->slabs;
+        second = dst->slabs;
+        dst->bump = src->bump;
+        dst->bump_end = src->bump_end;
+    }
+
+    PoolSlab *first_tail = (first == dst->slabs) ? dst->slabs_tail : src->slabs_tail;
+    PoolSlab *second_tail = (first == dst->slabs) ? src->slabs_tail : dst->slabs_tail;
+
+    if (first == NULL) {
+        first = second;
+        first_tail = second_tail;
+    } else if (second != NULL) {
+        first_tail->next = second;
+        first_tail = second_tail;
+    }
+    dst->slabs = first;
+    dst->slabs_tail = first_tail;
+
+    if (src->free_list != NULL) {
+        src->free_tail->next = dst->free_list;
+
+        if (dst->free_list == NULL) {
+            dst->free_tail = src->free_tail;
+        }
+
+        dst->free_list = src->free_list;
+    }
+
+    if (src->next_slab_blocks > dst->next_slab_blocks) {
+        dst->next_slab_blocks = src->next_slab_blocks;
+    }
+
+    src->slabs = NULL;
+    src->slabs_tail = NULL;
+    src->bump = NULL;
+    src->bump_end = NULL;
+    src->free_list = NULL;
+    src->free_tail = NULL;
+
+    return (POOL_OK);
+}
+
+
+/* utilities */
+
+/* cost: O(number of slabs) */
+int pool_owns(const PoolAllocator *pool, const void *block) {
+    if (pool == NULL || block == NULL) {
+        return (0);
+    }
+
+    const unsigned char *b = block;
+
+    pool = helper_root_const(pool);
+
+    for (const PoolSlab *slab = pool->slabs; slab != NULL; slab = slab->next) {
+        if (b >= slab->blocks && b < slab->blocks + slab->nblocks * pool->block_size) {
+            return (1);
+        }
+    }
+
+    return (0);
+}
+
+size_t pool_block_size(const PoolAllocator *pool) {
+    if (pool == NULL) {
+        return (0);
+    }
+
+    return (pool->block_size);
+}
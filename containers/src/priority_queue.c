@@ -37,6 +37,58 @@ PriorityQueue *pq_create(size_t elem_size, pq_cmp_fn cmp) {
     return (pq);
 }
 
+/**
+ * creates a new priority queue backed by a d-ary heap
+ *
+ * @param elem_size size of each element
+ * @param cmp comparator function (min-heap or max-heap)
+ * @param arity number of children per heap node
+ * @return pointer to the queue or NULL on failure
+ */
+PriorityQueue *pq_create_arity(size_t elem_size, pq_cmp_fn cmp, size_t arity) {
+    PriorityQueue *pq = malloc(sizeof(PriorityQueue));
+
+    if (pq == NULL) {
+        return (NULL);
+    }
+
+    pq->h = heap_create_arity(elem_size, cmp, arity);
+
+    if (pq->h == NULL) {
+        free(pq);
+        return (NULL);
+    }
+
+    return (pq);
+}
+
+/**
+ * creates a new priority queue holding a copy of the `n` elements of `base`,
+ * heapified in O(n)
+ *
+ * @param base pointer to the first element (may be NULL if `n` is 0)
+ * @param n number of elements
+ * @param elem_size size of each element
+ * @param cmp comparator function (min-heap or max-heap)
+ * @return pointer to the queue or NULL on failure
+ */
+PriorityQueue *pq_create_from(const void *base, size_t n, size_t elem_size, pq_cmp_fn cmp) {
+    PriorityQueue *pq = malloc(sizeof(PriorityQueue));
+
+    if (pq == NULL) {
+        return (NULL);
+    }
+
+    pq->h = heap_create_from(base, n, elem_size, cmp);
+
+    if (pq->h == NULL) {
+        free(pq);
+        return (NULL);
+    }
+
+    return (pq);
+}
+
 /**
  * destroys the priority queue and releases memory
  */
@@ -72,7 +72,7 @@ void *queue_front(const Queue *q) {
         return (NULL);
     }
 
-    return (sl_get(q->list, 0));
+    return (sl_front(q->list));
 }
 
 size_t queue_size(const Queue *q) {
@@ -0,0 +1,272 @@
+// implemented interface
+# include "radix_heap.h"
+
+// implementation dependencies
+# include <stdlib.h>
+# include <string.h>
+
+# define BUCKETS 65            // bucket 0 for keys equal to `last`, then one per bit
+# define MIN_BUCKET_CAPACITY 8
+
+/* entries of `stride` bytes: the key, then the payload (rounded up to keep keys aligned) */
+typedef struct RHBucket {
+    unsigned char *entries;
+    size_t size;
+    size_t capacity;
+    uint64_t min;    // smallest key of the bucket (meaningless while empty)
+} RHBucket;
+
+/* private data */
+typedef struct RadixHeap {
+    RHBucket buckets[BUCKETS];
+    uint64_t last;       // last key popped, every key in the heap is >= last
+    size_t size;         // number of entries
+    size_t elem_size;    // payload size
+    size_t stride;       // bytes per entry
+} RadixHeap;
+
+
+/* helpers */
+
+/* number of bits needed to write `x` (0 for 0) */
+static inline unsigned helper_bit_length(uint64_t x) {
+#if defined(__GNUC__)
+    return ((x == 0) ? 0 : 64 - (unsigned)__builtin_clzll(x));
+#else
+    unsigned n = 0;
+
+    while (x != 0) {
+        x >>= 1;
+        ++n;
+    }
+
+    return (n);
+#endif
+}
+
+static inline unsigned helper_bucket_of(uint64_t last, uint64_t key) {
+    return (helper_bit_length(key ^ last));
+}
+
+static inline uint64_t helper_key(const unsigned char *entry) {
+    uint64_t key;
+
+    memcpy(&key, entry, sizeof(key));
+    return (key);
+}
+
+/* makes room for `extra` more entries, nothing changes on failure */
+static int helper_reserve(RHBucket *bucket, size_t extra, size_t stride) {
+    if (extra <= bucket->capacity - bucket->size) {
+        return (RH_OK);
+    }
+
+    size_t needed = bucket->size + extra;
+    size_t capacity = (bucket->capacity < MIN_BUCKET_CAPACITY) ? MIN_BUCKET_CAPACITY : bucket->capacity;
+
+    while (capacity < needed) {
+        if (capacity > SIZE_MAX / 2) {
+            return (RH_ERR);
+        }
+        capacity *= 2;
+    }
+
+    if (capacity > SIZE_MAX / stride) {
+        return (RH_ERR);
+    }
+
+    unsigned char *entries = realloc(bucket->entries, capacity * stride);
+
+    if (entries == NULL) {
+        return (RH_ERR);
+    }
+
+    bucket->entries = entries;
+    bucket->capacity = capacity;
+
+    return (RH_OK);
+}
+
+/* appends an entry (the room must be reserved) */
+static inline void helper_append(RHBucket *bucket, const unsigned char *entry, uint64_t key, size_t stride) {
+    if (bucket->size == 0 || key < bucket->min) {
+        bucket->min = key;
+    }
+
+    memcpy(bucket->entries + bucket->size * stride, entry, stride);
+    bucket->size++;
+}
+
+/*
+** makes sure bucket 0 is not empty: the smallest key of the first non-empty
+** bucket becomes `last`, and that bucket is spread over the buckets below it
+** those were all empty, so a failed allocation midway is undone by emptying
+** them again (the source bucket is only cleared at the end)
+*/
+static int helper_refill(RadixHeap *rh) {
+    if (rh->buckets[0].size > 0) {
+        return (RH_OK);
+    }
+
+    if (rh->size == 0) {
+        return (RH_ERR);
+    }
+
+    unsigned b = 1;
+
+    while (rh->buckets[b].size == 0) {
+        ++b;
+    }
+
+    RHBucket *src = &rh->buckets[b];
+    size_t stride = rh->stride;
+    uint64_t min = src->min;
+
+    for (size_t i = 0; i < src->size; ++i) {
+        const unsigned char *entry = src->entries + i * stride;
+        uint64_t key = helper_key(entry);
+        RHBucket *dst = &rh->buckets[helper_bucket_of(min, key)];
+
+        if (helper_reserve(dst, 1, stride) == RH_ERR) {
+            for (unsigned t = 0; t < b; ++t) {
+                rh->buckets[t].size = 0;
+            }
+            return (RH_ERR);
+        }
+
+        helper_append(dst, entry, key, stride);
+    }
+
+    src->size = 0;
+    rh->last = min;
+
+    return (RH_OK);
+}
+
+
+/* constructor / destructor */
+
+RadixHeap *rh_create(size_t elem_size) {
+    size_t align = sizeof(uint64_t);
+
+    if (elem_size > SIZE_MAX - 2 * align) {
+        return (NULL);
+    }
+
+    RadixHeap *rh = malloc(sizeof(RadixHeap));
+
+    if (rh == NULL) {
+        return (NULL);
+    }
+
+    for (unsigned b = 0; b < BUCKETS; ++b) {
+        rh->buckets[b].entries = NULL;
+        rh->buckets[b].size = 0;
+        rh->buckets[b].capacity = 0;
+        rh->buckets[b].min = 0;
+    }
+
+    rh->last = 0;
+    rh->size = 0;
+    rh->elem_size = elem_size;
+    rh->stride = align + (elem_size + align - 1) / align * align;
+
+    return (rh);
+}
+
+void rh_destroy(RadixHeap *rh) {
+    if (rh == NULL) {
+        return ;
+    }
+
+    for (unsigned b = 0; b < BUCKETS; ++b) {
+        free(rh->buckets[b].entries);
+    }
+
+    free(rh);
+}
+
+
+/* modifiers */
+
+int rh_push(RadixHeap *rh, uint64_t key, const void *elem) {
+    if (rh == NULL || key < rh->last || (elem == NULL && rh->elem_size > 0)) {
+        return (RH_ERR);
+    }
+
+    RHBucket *bucket = &rh->buckets[helper_bucket_of(rh->last, key)];
+
+    if (helper_reserve(bucket, 1, rh->stride) == RH_ERR) {
+        return (RH_ERR);
+    }
+
+    unsigned char *entry = bucket->entries + bucket->size * rh->stride;
+
+    memcpy(entry, &key, sizeof(key));
+    if (rh->elem_size > 0) {
+        memcpy(entry + sizeof(key), elem, rh->elem_size);
+    }
+
+    if (bucket->size == 0 || key < bucket->min) {
+        bucket->min = key;
+    }
+
+    bucket->size++;
+    rh->size++;
+
+    return (RH_OK);
+}
+
+int rh_pop(RadixHeap *rh, uint64_t *key, void *out) {
+    if (rh_top(rh, key, out) == RH_ERR) {
+        return (RH_ERR);
+    }
+
+    rh->buckets[0].size--;
+    rh->size--;
+
+    return (RH_OK);
+}
+
+
+/* lookup */
+
+int rh_top(RadixHeap *rh, uint64_t *key, void *out) {
+    if (rh == NULL || helper_refill(rh) == RH_ERR) {
+        return (RH_ERR);
+    }
+
+    /* every entry of bucket 0 has key `last`, the newest one is taken */
+    const RHBucket *bucket = &rh->buckets[0];
+    const unsigned char *entry = bucket->entries + (bucket->size - 1) * rh->stride;
+
+    if (key != NULL) {
+        *key = rh->last;
+    }
+
+    if (out != NULL && rh->elem_size > 0) {
+        memcpy(out, entry + sizeof(uint64_t), rh->elem_size);
+    }
+
+    return (RH_OK);
+}
+
+uint64_t rh_last(const RadixHeap *rh) {
+    if (rh == NULL) {
+        return (0);
+    }
+
+    return (rh->last);
+}
+
+size_t rh_size(const RadixHeap *rh) {
+    if (rh == NULL) {
+        return (0);
+    }
+
+    return (rh->size);
+}
+
+int rh_is_empty(const RadixHeap *rh) {
+    return (rh == NULL || rh->size == 0);
+}
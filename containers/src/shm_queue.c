@@ -0,0 +1,361 @@
+/* shm_open / mmap / ftruncate are POSIX, not ISO C */
+# define _POSIX_C_SOURCE 200809L
+
+/* implemented interface */
+# include "shm_queue.h"
+
+/* implementation dependencies */
+# include <stdlib.h>
+# include <string.h>
+# include <stdint.h>
+# include <stdalign.h>
+# include <stdatomic.h>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+
+# define SHMQ_MAGIC 0x53484d5155455545ULL // "SHMQUEUE"
+# define CACHE_LINE 64
+
+/*
+** layout of the shared memory object:
+** [ ShmQueueHeader ][ slot 0 ][ slot 1 ] ... [ slot capacity - 1 ]
+** every slot is [ sequence number ][ elem_size bytes of payload ]
+**
+** the queue is a bounded multi-producer / multi-consumer ring (Vyukov style):
+** a slot's sequence number tells producers and consumers whose turn it is,
+** so no process ever stores a pointer into the region (it's mapped at a
+** different address in every process)
+*/
+typedef struct ShmQueueHeader {
+    _Atomic uint64_t magic; // written last by the creator, readers check it first
+    size_t elem_size;       // size of each element in bytes
+    size_t capacity;        // number of slots (power of two)
+    size_t slot_size;       // size of a slot in bytes (sequence + payload, padded)
+    alignas(CACHE_LINE) _Atomic size_t enqueue_pos; // next position to produce into
+    alignas(CACHE_LINE) _Atomic size_t dequeue_pos; // next position to consume from
+} ShmQueueHeader;
+
+typedef struct ShmSlot {
+    _Atomic size_t seq;
+    alignas(max_align_t) unsigned char data[];
+} ShmSlot;
+
+/* private data (process-local) */
+/* the geometry is copied out of the header once checked, another process can't change it afterwards */
+typedef struct ShmQueue {
+    ShmQueueHeader *hdr; // start of the mapping
+    unsigned char *slots; // first slot (right after the header)
+    size_t mask;         // capacity - 1
+    size_t elem_size;    // size of each element in bytes
+    size_t slot_size;    // size of a slot in bytes
+    size_t map_size;     // total size of the mapping in bytes
+} ShmQueue;
+
+
+/* helpers */
+
+/* header size, rounded so that the first slot is suitably aligned */
+static size_t helper_header_size(void) {
+    return ((sizeof(ShmQueueHeader) + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE);
+}
+
+/* returns the smallest power of two >= n, or 0 on overflow */
+static size_t helper_round_pow2(size_t n) {
+    size_t p = 1;
+
+    while (p < n) {
+        if (p > SIZE_MAX / 2) {
+            return (0);
+        }
+        p *= 2;
+    }
+
+    return (p);
+}
+
+static ShmSlot *helper_slot(const ShmQueue *q, size_t pos) {
+    return ((ShmSlot *)(q->slots + (pos & q->mask) * q->slot_size));
+}
+
+/* maps `size` bytes of the shared memory object `fd` and fills in the handle */
+/* return NULL to indicate failure (fd is left open for the caller to close) */
+static ShmQueue *helper_map(int fd, size_t size) {
+    ShmQueue *q = malloc(sizeof(ShmQueue));
+
+    if (q == NULL) {
+        return (NULL);
+    }
+
+    void *addr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    if (addr == MAP_FAILED) {
+        free(q);
+        return (NULL);
+    }
+
+    q->hdr = addr;
+    q->slots = (unsigned char *)addr + helper_header_size();
+    q->map_size = size;
+    q->mask = 0;
+    q->elem_size = 0;
+    q->slot_size = 0;
+
+    return (q);
+}
+
+
+/* constructors / destructor */
+
+ShmQueue *shmq_create(const char *name, size_t capacity, size_t elem_size) {
+    if (name == NULL || capacity == 0 || elem_size == 0) {
+        return (NULL);
+    }
+
+    capacity = helper_round_pow2(capacity);
+
+    if (capacity == 0 || elem_size > SIZE_MAX / 2) {
+        return (NULL);
+    }
+
+    /* slot = sequence + payload, padded so that every payload stays aligned */
+    size_t align = alignof(max_align_t);
+    size_t slot_size = (offsetof(ShmSlot, data) + elem_size + align - 1) / align * align;
+
+    if (capacity > (SIZE_MAX - helper_header_size()) / slot_size) {
+        return (NULL);
+    }
+
+    size_t map_size = helper_header_size() + capacity * slot_size;
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+
+    if (fd == -1) {
+        return (NULL);
+    }
+
+    if (ftruncate(fd, (off_t)map_size) == -1) {
+        close(fd);
+        shm_unlink(name);
+        return (NULL);
+    }
+
+    ShmQueue *q = helper_map(fd, map_size);
+    close(fd); // the mapping keeps the object alive
+
+    if (q == NULL) {
+        shm_unlink(name);
+        return (NULL);
+    }
+
+    ShmQueueHeader *hdr = q->hdr;
+
+    hdr->elem_size = elem_size;
+    hdr->capacity = capacity;
+    hdr->slot_size = slot_size;
+    atomic_init(&hdr->enqueue_pos, 0);
+    atomic_init(&hdr->dequeue_pos, 0);
+    q->mask = capacity - 1;
+    q->elem_size = elem_size;
+    q->slot_size = slot_size;
+
+    /* slot i is free for the producer at position i */
+    for (size_t i = 0; i < capacity; ++i) {
+        atomic_init(&helper_slot(q, i)->seq, i);
+    }
+
+    /* publish: attaching processes only trust the header once the magic is set */
+    atomic_store_explicit(&hdr->magic, SHMQ_MAGIC, memory_order_release);
+
+    return (q);
+}
+
+ShmQueue *shmq_open(const char *name) {
+    if (name == NULL) {
+        return (NULL);
+    }
+
+    int fd = shm_open(name, O_RDWR, 0);
+
+    if (fd == -1) {
+        return (NULL);
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) == -1 || (size_t)st.st_size < helper_header_size()) {
+        close(fd);
+        return (NULL);
+    }
+
+    ShmQueue *q = helper_map(fd, (size_t)st.st_size);
+    close(fd);
+
+    if (q == NULL) {
+        return (NULL);
+    }
+
+    ShmQueueHeader *hdr = q->hdr;
+
+    /* the creator may not have finished initializing the region yet */
+    if (atomic_load_explicit(&hdr->magic, memory_order_acquire) != SHMQ_MAGIC) {
+        shmq_close(q);
+        return (NULL);
+    }
+
+    /* another process wrote the header: every slot access must stay inside the mapping */
+    size_t elem_size = hdr->elem_size;
+    size_t capacity = hdr->capacity;
+    size_t slot_size = hdr->slot_size;
+
+    if (elem_size == 0 || capacity == 0 || (capacity & (capacity - 1)) != 0
+        || slot_size < offsetof(ShmSlot, data) || slot_size % alignof(max_align_t) != 0
+        || elem_size > slot_size - offsetof(ShmSlot, data)
+        || capacity > (q->map_size - helper_header_size()) / slot_size) {
+        shmq_close(q);
+        return (NULL);
+    }
+
+    q->mask = capacity - 1;
+    q->elem_size = elem_size;
+    q->slot_size = slot_size;
+
+    return (q);
+}
+
+void shmq_close(ShmQueue *q) {
+    if (q == NULL) {
+        return ;
+    }
+
+    munmap(q->hdr, q->map_size);
+    free(q);
+}
+
+int shmq_unlink(const char *name) {
+    if (name == NULL || shm_unlink(name) == -1) {
+        return (SHMQ_ERR);
+    }
+
+    return (SHMQ_OK);
+}
+
+
+/* operations */
+
+int shmq_enqueue(ShmQueue *q, const void *elem) {
+    if (q == NULL || elem == NULL) {
+        return (SHMQ_ERR);
+    }
+
+    ShmQueueHeader *hdr = q->hdr;
+    size_t pos = atomic_load_explicit(&hdr->enqueue_pos, memory_order_relaxed);
+    ShmSlot *slot;
+
+    for (;;) {
+        slot = helper_slot(q, pos);
+        size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0) {
+            /* slot is free at our position, try to claim it */
+            if (atomic_compare_exchange_weak_explicit(&hdr->enqueue_pos, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                break ;
+            }
+        } else if (diff < 0) {
+            /* the consumer of the previous lap hasn't released the slot: full */
+            return (SHMQ_ERR);
+        } else {
+            /* another producer claimed this position, catch up */
+            pos = atomic_load_explicit(&hdr->enqueue_pos, memory_order_relaxed);
+        }
+    }
+
+    memcpy(slot->data, elem, q->elem_size);
+
+    /* hand the slot over to the consumer of position `pos` */
+    atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+
+    return (SHMQ_OK);
+}
+
+int shmq_dequeue(ShmQueue *q, void *dst) {
+    if (q == NULL || dst == NULL) {
+        return (SHMQ_ERR);
+    }
+
+    ShmQueueHeader *hdr = q->hdr;
+    size_t pos = atomic_load_explicit(&hdr->dequeue_pos, memory_order_relaxed);
+    ShmSlot *slot;
+
+    for (;;) {
+        slot = helper_slot(q, pos);
+        size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+        if (diff == 0) {
+            /* slot holds the element of our position, try to claim it */
+            if (atomic_compare_exchange_weak_explicit(&hdr->dequeue_pos, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                break ;
+            }
+        } else if (diff < 0) {
+            /* no producer has filled this position yet: empty */
+            return (SHMQ_ERR);
+        } else {
+            /* another consumer claimed this position, catch up */
+            pos = atomic_load_explicit(&hdr->dequeue_pos, memory_order_relaxed);
+        }
+    }
+
+    memcpy(dst, slot->data, q->elem_size);
+
+    /* release the slot to the producer of the next lap */
+    atomic_store_explicit(&slot->seq, pos + q->mask + 1, memory_order_release);
+
+    return (SHMQ_OK);
+}
+
+
+/* utilities */
+
+size_t shmq_size(const ShmQueue *q) {
+    if (q == NULL) {
+        return (0);
+    }
+
+    size_t tail = atomic_load_explicit(&q->hdr->dequeue_pos, memory_order_acquire);
+    size_t head = atomic_load_explicit(&q->hdr->enqueue_pos, memory_order_acquire);
+
+    /* positions are read separately, clamp the racy snapshot */
+    if (head < tail) {
+        return (0);
+    }
+
+    if (head - tail > q->mask + 1) {
+        return (q->mask + 1);
+    }
+
+    return (head - tail);
+}
+
+size_t shmq_capacity(const ShmQueue *q) {
+    if (q == NULL) {
+        return (0);
+    }
+
+    return (q->mask + 1);
+}
+
+size_t shmq_elem_size(const ShmQueue *q) {
+    if (q == NULL) {
+        return (0);
+    }
+
+    return (q->elem_size);
+}
+
+int shmq_is_empty(const ShmQueue *q) {
+    return (q == NULL || shmq_size(q) == 0);
+}
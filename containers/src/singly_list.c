@@ -1,22 +1,34 @@
 /* implemented interface */
 # include "singly_list.h"
 
+/* implementation dependencies */
+# include "pool_allocator.h"
+# include <stdlib.h>
+# include <string.h>
+# include <stdalign.h>
+# include <stddef.h>
+# include <stdint.h>
+
+# define SORT_MAX_RUNS 64   // runs of 2^0 .. 2^63 nodes, enough for any size_t count
+
 /* singly linked list's node */
+/* the element is stored inline, right after the link (one allocation per node) */
 typedef struct SLNode {
-    void *data;
     struct SLNode *next;
+    alignas(max_align_t) unsigned char data[];
 } SLNode;
 
-/* implementation dependencies */
-# include <stdlib.h>
-# include <string.h>
-
 /* private data */
 typedef struct SinglyList {
     size_t size; // number of nodes in the list
     size_t elem_size; // size of element in bytes
     SLNode *head; // the first node in the list
     SLNode *tail; // the last node in the list
+    PoolAllocator *pool; // node storage (slabs + free list)
+    SLNode *finger; // last node reached by index, NULL when unknown
+    size_t finger_index; // index of `finger`
+    PoolAllocator *old_pool; // pool being emptied by a compaction in progress, NULL otherwise
+    SLNode *compact_prev; // last node the compaction visited, NULL to resume from the head
 } SinglyList;
 
 
@@ -29,27 +41,21 @@ static SLNode *helper_new_node(SinglyList *list, SLNode *next, const void *src)
         return (NULL);
     }
 
-    SLNode *new_node = malloc(sizeof(SLNode));
+    SLNode *new_node = pool_alloc(list->pool);
 
     if (new_node == NULL) {
         return (NULL);
     }
 
     new_node->next = next;
-    new_node->data = malloc(list->elem_size);
-
-    if (new_node->data == NULL) {
-        free(new_node);
-        return (NULL);
-    }
-
     memcpy(new_node->data, src, list->elem_size);
 
     return (new_node);
 }
 
 /* returns a pointer to the node at the index `index` */
-static SLNode *helper_get_node(const SinglyList *list, size_t index) {
+/* the walk starts from the finger when it's at or before `index` (sequential access is O(1)) */
+static SLNode *helper_get_node(SinglyList *list, size_t index) {
     if (list == NULL) {
         return (NULL);
     }
@@ -58,34 +64,109 @@ static SLNode *helper_get_node(const SinglyList *list, size_t index) {
         return (NULL);
     }
 
+    if (index == list->size - 1) {
+        return (list->tail);
+    }
+
     SLNode *curr = list->head;
+    size_t i = 0;
+
+    if (list->finger != NULL && list->finger_index <= index) {
+        curr = list->finger;
+        i = list->finger_index;
+    }
 
-    while (index--) {
+    while (i < index) {
         curr = curr->next;
+        i++;
     }
 
+    list->finger = curr;
+    list->finger_index = index;
+
     return (curr);
 }
 
-/* releases memory acquired previously by both node->data and node */
-/* returns the next node (pointed to by `node->next`) */
-static SLNode *helper_destroy_node(SLNode *node) {
+/* keeps the finger on the same node when an element is inserted at `index` */
+static void helper_finger_inserted(SinglyList *list, size_t index) {
+    if (list->finger != NULL && index <= list->finger_index) {
+        list->finger_index++;
+    }
+}
+
+/* keeps the finger usable when the element `node` at `index` is removed */
+/* `prev` is the node before it (NULL when removing the head) */
+static void helper_finger_removed(SinglyList *list, size_t index, SLNode *node, SLNode *prev) {
+    if (list->finger == NULL) {
+        return ;
+    }
+
+    if (list->finger == node) {
+        /* step back onto the previous node, so removal loops keep their O(1) walk */
+        list->finger = prev;
+        list->finger_index = index - 1;
+    } else if (index < list->finger_index) {
+        list->finger_index--;
+    }
+}
+
+/* gives the node (element included) back to the pool it comes from */
+/* `prev` is the node before it (NULL for the head), returns the next node */
+static SLNode *helper_destroy_node(SinglyList *list, SLNode *node, SLNode *prev) {
     if (node == NULL) {
         return (NULL);
     }
 
-    void *data = node->data;
     SLNode *next = node->next;
 
-    free(node);
+    if (list->compact_prev == node) {
+        list->compact_prev = prev;
+    }
 
-    if (data != NULL) {
-        free(data);
+    if (list->old_pool != NULL && !pool_owns(list->pool, node)) {
+        pool_free(list->old_pool, node);
+    } else {
+        pool_free(list->pool, node);
     }
 
     return (next);
 }
 
+/* stops a compaction in progress: the nodes already moved stay where they are */
+/* and the fresh pool joins the old one, in O(1) */
+static void helper_compact_cancel(SinglyList *list) {
+    if (list->old_pool == NULL) {
+        return ;
+    }
+
+    pool_absorb(list->old_pool, list->pool);
+    pool_destroy(list->pool);
+    list->pool = list->old_pool;
+    list->old_pool = NULL;
+    list->compact_prev = NULL;
+}
+
+/* stable merge of two NULL-terminated runs */
+static SLNode *helper_merge_runs(SLNode *a, SLNode *b, sl_cmp_fn cmp) {
+    SLNode *merged = NULL;
+    SLNode **link = &merged;
+
+    while (a != NULL && b != NULL) {
+        /* on ties, the node from the earlier run `a` goes first */
+        if (cmp(b->data, a->data) < 0) {
+            *link = b;
+            b = b->next;
+        } else {
+            *link = a;
+            a = a->next;
+        }
+        link = &(*link)->next;
+    }
+
+    *link = (a != NULL) ? a : b;
+    return (merged);
+}
+
 /* constructor */
 /* elem_size must be greater than 0 */
 /* return NULL to indicate construction failure */
@@ -100,22 +181,69 @@ SinglyList *sl_create(size_t elem_size) {
         return (NULL);
     }
 
+    sl->pool = pool_create(sizeof(SLNode) + elem_size);
+
+    if (sl->pool == NULL) {
+        free(sl);
+        return (NULL);
+    }
+
     sl->size = 0;
     sl->elem_size = elem_size;
     sl->head = NULL;
     sl->tail = NULL;
+    sl->finger = NULL;
+    sl->finger_index = 0;
+    sl->old_pool = NULL;
+    sl->compact_prev = NULL;
 
     return (sl);
 }
 
+/* builds a list holding a copy of the `count` elements of `src`, in order */
+/* every node is carved from one reserved slab, in array order */
+SinglyList *sl_from_array(size_t elem_size, const void *src, size_t count) {
+    if (src == NULL && count > 0) {
+        return (NULL);
+    }
+
+    SinglyList *list = sl_create(elem_size);
+
+    if (list == NULL || count == 0) {
+        return (list);
+    }
+
+    if (pool_reserve(list->pool, count) == POOL_ERR) {
+        sl_destroy(list);
+        return (NULL);
+    }
+
+    const unsigned char *bytes = src;
+    SLNode **link = &list->head;
+    SLNode *node = NULL;
+
+    for (size_t i = 0; i < count; ++i) {
+        node = pool_alloc(list->pool); // can't fail, the blocks are reserved
+        memcpy(node->data, bytes + i * elem_size, elem_size);
+        *link = node;
+        link = &node->next;
+    }
+
+    *link = NULL;
+    list->tail = node;
+    list->size = count;
+    return (list);
+}
+
 /* destructor */
 void sl_destroy(SinglyList *list) {
     if (list == NULL) {
         return ;
     }
 
-    /* clear list */
-    sl_clear(list);
+    /* reclaim every node at once */
+    helper_compact_cancel(list);
+    pool_destroy(list->pool);
 
     /* reclaim object memory block */
     free(list);
@@ -140,6 +268,7 @@ int sl_push_front(SinglyList *list, const void *src) {
     if (list->tail == NULL) {
         list->tail = new_node;
     }
+    helper_finger_inserted(list, 0);
     list->head = new_node;
     list->size++;
     return (SL_OK);
@@ -202,8 +331,14 @@ int sl_insert_at(SinglyList *list, size_t index, const void *src) {
     }
 
     SLNode *new_node = helper_new_node(list, next_node, src);
+
+    if (new_node == NULL) {
+        return (SL_ERR);
+    }
+
     prev_node->next = new_node;
 
+    helper_finger_inserted(list, index);
     list->size++;
 
     return (SL_OK);
@@ -213,11 +348,13 @@ int sl_insert_at(SinglyList *list, size_t index, const void *src) {
 /* deletion */
 
 int sl_pop_front(SinglyList *list) {
-    if (list == NULL) {
+    if (list == NULL || list->head == NULL) {
         return (SL_ERR);
     }
 
-    SLNode *next = helper_destroy_node(list->head); 
+    helper_finger_removed(list, 0, list->head, NULL);
+
+    SLNode *next = helper_destroy_node(list, list->head, NULL);
     list->head = next;
 
     /* handling the case where list->size is 1 */
@@ -249,7 +386,9 @@ int sl_remove_at(SinglyList *list, size_t index) {
         return (SL_ERR);
     }
 
-    SLNode *next = helper_destroy_node(prev->next);
+    helper_finger_removed(list, index, prev->next, prev);
+
+    SLNode *next = helper_destroy_node(list, prev->next, prev);
 
     if (index == list->size - 1) {
         list->tail = prev;
@@ -279,7 +418,7 @@ void *sl_back(const SinglyList *list) {
     return (list->tail->data);
 }
 
-void *sl_get(const SinglyList *list, size_t index) {
+void *sl_get(SinglyList *list, size_t index) {
     SLNode *node = helper_get_node(list, index);
 
     if (node == NULL) {
@@ -305,21 +444,296 @@ int sl_is_empty(const SinglyList *list) {
     return (list == NULL || list->size == 0);
 }
 
+/* copies at most `capacity` elements, in order, with one walk */
+size_t sl_to_array(const SinglyList *list, void *dst, size_t capacity) {
+    if (list == NULL || dst == NULL) {
+        return (0);
+    }
+
+    unsigned char *bytes = dst;
+    size_t count = 0;
+
+    for (SLNode *node = list->head; node != NULL && count < capacity; node = node->next) {
+        memcpy(bytes + count * list->elem_size, node->data, list->elem_size);
+        count++;
+    }
+
+    return (count);
+}
+
 /* clears the list, after this call, the list->size is 0 */
 void sl_clear(SinglyList *list) {
     if (list == NULL) {
         return ;
     }
 
-    SLNode *curr = list->head;
-
-    /* reclaim all SLNode memory blocks */
-    while (curr != NULL) {
-        curr = helper_destroy_node(curr); // returns the next node
-    }
+    /* reclaim all SLNode memory blocks in bulk (no per-node walk) */
+    helper_compact_cancel(list);
+    pool_clear(list->pool);
 
     list->head = NULL;
     list->tail = NULL;
+    list->finger = NULL;
     list->size = 0;
 }
 
+
+
+/* cursor */
+
+SLCursor sl_cursor_begin(SinglyList *list) {
+    SLCursor cur = { NULL, NULL, NULL };
+
+    if (list == NULL) {
+        return (cur);
+    }
+
+    cur.list = list;
+    cur.node = list->head;
+
+    return (cur);
+}
+
+int sl_cursor_is_end(const SLCursor *cur) {
+    return (cur == NULL || cur->list == NULL || cur->node == NULL);
+}
+
+int sl_cursor_next(SLCursor *cur) {
+    if (sl_cursor_is_end(cur)) {
+        return (SL_ERR);
+    }
+
+    cur->prev = cur->node;
+    cur->node = cur->node->next;
+    return (SL_OK);
+}
+
+void *sl_cursor_get(const SLCursor *cur) {
+    if (sl_cursor_is_end(cur)) {
+        return (NULL);
+    }
+
+    return (cur->node->data);
+}
+
+/* the new node goes between cur->prev and cur->node */
+int sl_cursor_insert_before(SLCursor *cur, const void *src) {
+    if (cur == NULL || cur->list == NULL || src == NULL) {
+        return (SL_ERR);
+    }
+
+    SinglyList *list = cur->list;
+    SLNode *new_node = helper_new_node(list, cur->node, src);
+
+    if (new_node == NULL) {
+        return (SL_ERR);
+    }
+
+    if (cur->prev == NULL) {
+        list->head = new_node;
+    } else {
+        cur->prev->next = new_node;
+    }
+
+    /* inserting past the end appends */
+    if (cur->node == NULL) {
+        list->tail = new_node;
+    }
+
+    cur->prev = new_node;
+    list->finger = NULL; // cursors don't track indices
+    list->size++;
+    return (SL_OK);
+}
+
+int sl_cursor_insert_after(SLCursor *cur, const void *src) {
+    if (sl_cursor_is_end(cur) || src == NULL) {
+        return (SL_ERR);
+    }
+
+    SinglyList *list = cur->list;
+    SLNode *new_node = helper_new_node(list, cur->node->next, src);
+
+    if (new_node == NULL) {
+        return (SL_ERR);
+    }
+
+    if (cur->node == list->tail) {
+        list->tail = new_node;
+    }
+
+    cur->node->next = new_node;
+    list->finger = NULL; // cursors don't track indices
+    list->size++;
+    return (SL_OK);
+}
+
+int sl_cursor_erase(SLCursor *cur) {
+    if (sl_cursor_is_end(cur)) {
+        return (SL_ERR);
+    }
+
+    SinglyList *list = cur->list;
+    SLNode *node = cur->node;
+
+    if (cur->prev == NULL) {
+        list->head = node->next;
+    } else {
+        cur->prev->next = node->next;
+    }
+
+    if (node == list->tail) {
+        list->tail = cur->prev;
+    }
+
+    cur->node = helper_destroy_node(list, node, cur->prev); // returns the next node
+    list->finger = NULL; // cursors don't track indices
+    list->size--;
+    return (SL_OK);
+}
+
+
+
+/* sort */
+
+/* bottom-up merge sort: runs of 2^i nodes are kept in runs[i] and merged like a binary counter */
+int sl_sort(SinglyList *list, sl_cmp_fn cmp) {
+    if (list == NULL || cmp == NULL) {
+        return (SL_ERR);
+    }
+
+    if (list->size < 2) {
+        return (SL_OK);
+    }
+
+    SLNode *runs[SORT_MAX_RUNS] = { NULL };
+    size_t nruns = 0;
+    SLNode *node = list->head;
+
+    while (node != NULL) {
+        SLNode *carry = node;
+        node = node->next;
+        carry->next = NULL;
+
+        size_t i = 0;
+        while (i < nruns && runs[i] != NULL) {
+            carry = helper_merge_runs(runs[i], carry, cmp);
+            runs[i] = NULL;
+            i++;
+        }
+
+        if (i == nruns) {
+            nruns++;
+        }
+        runs[i] = carry;
+    }
+
+    /* higher runs hold earlier elements, so they go on the left */
+    SLNode *sorted = NULL;
+    for (size_t i = 0; i < nruns; ++i) {
+        if (runs[i] != NULL) {
+            sorted = helper_merge_runs(runs[i], sorted, cmp);
+        }
+    }
+
+    list->head = sorted;
+    list->tail = sorted;
+    while (list->tail->next != NULL) {
+        list->tail = list->tail->next;
+    }
+
+    /* a compaction in progress starts its walk over (moved nodes are skipped) */
+    list->compact_prev = NULL;
+    list->finger = NULL;
+    return (SL_OK);
+}
+
+
+
+/* compaction */
+
+/*
+** a compaction moves the nodes, in traversal order, from the current pool
+** (kept as old_pool) into a fresh pool whose first slab is big enough for
+** all of them, the walk resumes after compact_prev
+** the list stays usable between steps: new nodes come from the fresh pool,
+** freed nodes go back to the pool owning them, and the walk skips nodes that
+** already live in the fresh pool
+*/
+int sl_compact_step(SinglyList *list, size_t max_nodes) {
+    if (list == NULL) {
+        return (SL_ERR);
+    }
+
+    if (list->old_pool == NULL) {
+        if (list->size == 0) {
+            return (SL_OK);
+        }
+
+        PoolAllocator *fresh = pool_create(sizeof(SLNode) + list->elem_size);
+
+        if (fresh == NULL || pool_reserve(fresh, list->size) == POOL_ERR) {
+            pool_destroy(fresh);
+            return (SL_ERR);
+        }
+
+        list->old_pool = list->pool;
+        list->pool = fresh;
+        list->compact_prev = NULL;
+    }
+
+    SLNode *prev = list->compact_prev;
+    SLNode *node = (prev == NULL) ? list->head : prev->next;
+
+    while (max_nodes > 0 && node != NULL) {
+        max_nodes--;
+
+        if (!pool_owns(list->pool, node)) {
+            SLNode *copy = pool_alloc(list->pool);
+
+            if (copy == NULL) {
+                list->compact_prev = prev;
+                return (SL_ERR);  // nothing lost, the next step resumes on `node`
+            }
+
+            memcpy(copy->data, node->data, list->elem_size);
+            copy->next = node->next;
+
+            if (prev == NULL) {
+                list->head = copy;
+            } else {
+                prev->next = copy;
+            }
+
+            if (list->tail == node) {
+                list->tail = copy;
+            }
+
+            if (list->finger == node) {
+                list->finger = copy;
+            }
+
+            pool_free(list->old_pool, node);
+            node = copy;
+        }
+
+        prev = node;
+        node = node->next;
+    }
+
+    list->compact_prev = prev;
+
+    if (node != NULL) {
+        return (SL_PENDING);
+    }
+
+    /* every node lives in the fresh pool now */
+    pool_destroy(list->old_pool);
+    list->old_pool = NULL;
+    list->compact_prev = NULL;
+    return (SL_OK);
+}
+
+int sl_compact(SinglyList *list) {
+    return (sl_compact_step(list, SIZE_MAX));
+}
@@ -0,0 +1,519 @@
+/* implemented interface */
+# include "skip_list.h"
+
+/* implementation dependencies */
+# include <stdlib.h>
+# include <string.h>
+# include <stdint.h>
+# include <stdalign.h>
+# include <stdatomic.h>
+
+# define MAX_LEVEL 32   // levels of the head node (plenty for 4^32 elements)
+
+/* one level of a node: the next node on that level, and how far it is */
+typedef struct SKLLink {
+    _Atomic(struct SKLNode *) next;
+    size_t span;   // level-0 steps to `next` (maintained on single-threaded lists only)
+} SKLLink;
+
+/* the element is stored inline, followed by `height` links */
+typedef struct SKLNode {
+    size_t height;
+    alignas(max_align_t) unsigned char data[];
+} SKLNode;
+
+/*
+** private data
+**
+** level i links the nodes of height > i in sorted order, level 0 links them all
+** the head node has MAX_LEVEL links and no element, levels [level, MAX_LEVEL)
+** are unused
+** on a concurrent list, nodes are only ever added (never freed before destroy),
+** so readers can follow links without any reclamation scheme
+*/
+typedef struct SkipList {
+    _Atomic size_t size;     // number of elements
+    _Atomic size_t level;    // number of levels in use (at least 1)
+    size_t elem_size;        // size of each element in bytes
+    size_t links_offset;     // offset of the links in a node's data
+    skl_cmp_fn cmp;          // ordering of the elements
+    int concurrent;          // created by skl_create_concurrent
+    SKLNode *head;           // sentinel in front of every level
+} SkipList;
+
+
+/* helpers */
+
+/* per-thread xorshift state, so concurrent inserters never share it */
+static _Thread_local uint64_t tls_rng;
+
+/* returns a random height: each extra level with probability 1/4 */
+static size_t helper_random_height(void) {
+    uint64_t x = tls_rng;
+
+    if (x == 0) {
+        x = (uint64_t)(uintptr_t)&tls_rng ^ 0x9E3779B97F4A7C15ull;
+    }
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    tls_rng = x;
+
+    size_t height = 1;
+
+    while (height < MAX_LEVEL && (x & 3) == 0) {
+        height++;
+        x >>= 2;
+    }
+
+    return (height);
+}
+
+static inline SKLLink *helper_links(const SkipList *list, SKLNode *node) {
+    return ((SKLLink *)(node->data + list->links_offset));
+}
+
+static inline SKLNode *helper_next(const SkipList *list, SKLNode *node, size_t level) {
+    return (atomic_load_explicit(&helper_links(list, node)[level].next, memory_order_acquire));
+}
+
+static inline void helper_set_next(const SkipList *list, SKLNode *node, size_t level, SKLNode *next) {
+    atomic_store_explicit(&helper_links(list, node)[level].next, next, memory_order_release);
+}
+
+static inline size_t helper_level(const SkipList *list) {
+    return (atomic_load_explicit(&list->level, memory_order_relaxed));
+}
+
+/* return NULL to indicate failure, `elem` may be NULL (head node) */
+static SKLNode *helper_new_node(const SkipList *list, size_t height, const void *elem) {
+    SKLNode *node = malloc(sizeof(SKLNode) + list->links_offset + height * sizeof(SKLLink));
+
+    if (node == NULL) {
+        return (NULL);
+    }
+
+    node->height = height;
+
+    if (elem != NULL) {
+        memcpy(node->data, elem, list->elem_size);
+    }
+
+    SKLLink *links = helper_links(list, node);
+
+    for (size_t i = 0; i < height; ++i) {
+        atomic_init(&links[i].next, NULL);
+        links[i].span = 0;
+    }
+
+    return (node);
+}
+
+/* returns the first node not less than `key` (NULL if none) */
+static SKLNode *helper_lower_bound(const SkipList *list, const void *key) {
+    SKLNode *x = list->head;
+    SKLNode *next = NULL;
+
+    for (size_t i = helper_level(list); i-- > 0; ) {
+        while ((next = helper_next(list, x, i)) != NULL && list->cmp(next->data, key) < 0) {
+            x = next;
+        }
+    }
+
+    /* the successor seen on level 0, reloading it could observe a smaller node inserted meanwhile */
+    return (next);
+}
+
+/* fills preds / succs with the insertion point of `elem` (after the equal ones) on every level */
+static void helper_find_insertion(const SkipList *list, const void *elem, SKLNode **preds, SKLNode **succs) {
+    SKLNode *x = list->head;
+
+    for (size_t i = MAX_LEVEL; i-- > 0; ) {
+        SKLNode *next;
+
+        while ((next = helper_next(list, x, i)) != NULL && list->cmp(next->data, elem) <= 0) {
+            x = next;
+        }
+
+        preds[i] = x;
+        succs[i] = next;
+    }
+}
+
+/* sequential insertion, keeping the spans right */
+static int helper_insert(SkipList *list, const void *elem) {
+    SKLNode *update[MAX_LEVEL];
+    size_t rank[MAX_LEVEL];     // rank[i]: level-0 position of update[i] (head is 0)
+    size_t level = helper_level(list);
+    SKLNode *x = list->head;
+
+    for (size_t i = level; i-- > 0; ) {
+        rank[i] = (i == level - 1) ? 0 : rank[i + 1];
+        SKLNode *next;
+
+        while ((next = helper_next(list, x, i)) != NULL && list->cmp(next->data, elem) <= 0) {
+            rank[i] += helper_links(list, x)[i].span;
+            x = next;
+        }
+
+        update[i] = x;
+    }
+
+    size_t height = helper_random_height();
+    SKLNode *node = helper_new_node(list, height, elem);
+
+    if (node == NULL) {
+        return (SKL_ERR);
+    }
+
+    size_t size = atomic_load_explicit(&list->size, memory_order_relaxed);
+
+    /* new levels start from the head and span the whole list */
+    if (height > level) {
+        for (size_t i = level; i < height; ++i) {
+            rank[i] = 0;
+            update[i] = list->head;
+            helper_links(list, list->head)[i].span = size;
+        }
+        atomic_store_explicit(&list->level, height, memory_order_relaxed);
+        level = height;
+    }
+
+    for (size_t i = 0; i < height; ++i) {
+        SKLLink *prev_link = &helper_links(list, update[i])[i];
+        SKLLink *link = &helper_links(list, node)[i];
+
+        atomic_store_explicit(&link->next, atomic_load_explicit(&prev_link->next, memory_order_relaxed), memory_order_relaxed);
+        link->span = prev_link->span - (rank[0] - rank[i]);
+        prev_link->span = rank[0] - rank[i] + 1;
+        helper_set_next(list, update[i], i, node);
+    }
+
+    /* links jumping over the new node got one step longer */
+    for (size_t i = height; i < level; ++i) {
+        helper_links(list, update[i])[i].span++;
+    }
+
+    atomic_store_explicit(&list->size, size + 1, memory_order_relaxed);
+    return (SKL_OK);
+}
+
+/*
+** lock-free insertion: the node is published on level 0 first, then on each
+** upper level with one CAS, searching again whenever a CAS loses a race
+** (nodes are never removed, so a failed CAS only means a new neighbour)
+*/
+static int helper_insert_concurrent(SkipList *list, const void *elem) {
+    SKLNode *preds[MAX_LEVEL];
+    SKLNode *succs[MAX_LEVEL];
+    size_t height = helper_random_height();
+    SKLNode *node = helper_new_node(list, height, elem);
+
+    if (node == NULL) {
+        return (SKL_ERR);
+    }
+
+    /* raise the level in use first, so the node is reachable as soon as it's linked */
+    size_t level = helper_level(list);
+    while (height > level
+        && !atomic_compare_exchange_weak_explicit(&list->level, &level, height, memory_order_relaxed, memory_order_relaxed)) {
+        ;
+    }
+
+    helper_find_insertion(list, elem, preds, succs);
+
+    for (size_t i = 0; i < height; ) {
+        SKLNode *expected = succs[i];
+
+        atomic_store_explicit(&helper_links(list, node)[i].next, expected, memory_order_relaxed);
+
+        if (atomic_compare_exchange_strong_explicit(&helper_links(list, preds[i])[i].next, &expected, node,
+            memory_order_release, memory_order_relaxed)) {
+            i++;
+            continue ;
+        }
+
+        helper_find_insertion(list, elem, preds, succs);
+    }
+
+    atomic_fetch_add_explicit(&list->size, 1, memory_order_relaxed);
+    return (SKL_OK);
+}
+
+/* frees every node but the head */
+static void helper_free_nodes(SkipList *list) {
+    SKLNode *node = helper_next(list, list->head, 0);
+
+    while (node != NULL) {
+        SKLNode *next = helper_next(list, node, 0);
+        free(node);
+        node = next;
+    }
+}
+
+/* return NULL to indicate construction failure */
+static SkipList *helper_create(size_t elem_size, skl_cmp_fn cmp, int concurrent) {
+    if (elem_size == 0 || cmp == NULL || elem_size > SIZE_MAX / 2) {
+        return (NULL);
+    }
+
+    SkipList *list = malloc(sizeof(SkipList));
+
+    if (list == NULL) {
+        return (NULL);
+    }
+
+    list->elem_size = elem_size;
+    list->links_offset = (elem_size + alignof(SKLLink) - 1) / alignof(SKLLink) * alignof(SKLLink);
+    list->cmp = cmp;
+    list->concurrent = concurrent;
+    atomic_init(&list->size, 0);
+    atomic_init(&list->level, 1);
+
+    list->head = helper_new_node(list, MAX_LEVEL, NULL);
+
+    if (list->head == NULL) {
+        free(list);
+        return (NULL);
+    }
+
+    return (list);
+}
+
+
+/* constructor / destructor */
+
+SkipList *skl_create(size_t elem_size, skl_cmp_fn cmp) {
+    return (helper_create(elem_size, cmp, 0));
+}
+
+SkipList *skl_create_concurrent(size_t elem_size, skl_cmp_fn cmp) {
+    return (helper_create(elem_size, cmp, 1));
+}
+
+void skl_destroy(SkipList *list) {
+    if (list == NULL) {
+        return ;
+    }
+
+    helper_free_nodes(list);
+    free(list->head);
+    free(list);
+}
+
+
+/* modifiers */
+
+int skl_insert(SkipList *list, const void *elem) {
+    if (list == NULL || elem == NULL) {
+        return (SKL_ERR);
+    }
+
+    if (list->concurrent) {
+        return (helper_insert_concurrent(list, elem));
+    }
+
+    return (helper_insert(list, elem));
+}
+
+int skl_erase(SkipList *list, const void *key) {
+    if (list == NULL || key == NULL || list->concurrent) {
+        return (SKL_ERR);
+    }
+
+    SKLNode *update[MAX_LEVEL];
+    size_t level = helper_level(list);
+    SKLNode *x = list->head;
+
+    for (size_t i = level; i-- > 0; ) {
+        SKLNode *next;
+
+        while ((next = helper_next(list, x, i)) != NULL && list->cmp(next->data, key) < 0) {
+            x = next;
+        }
+
+        update[i] = x;
+    }
+
+    SKLNode *node = helper_next(list, x, 0);
+
+    if (node == NULL || list->cmp(node->data, key) != 0) {
+        return (SKL_ERR);
+    }
+
+    for (size_t i = 0; i < level; ++i) {
+        SKLLink *prev_link = &helper_links(list, update[i])[i];
+
+        if (helper_next(list, update[i], i) == node) {
+            prev_link->span += helper_links(list, node)[i].span - 1;
+            helper_set_next(list, update[i], i, helper_next(list, node, i));
+        } else {
+            prev_link->span--;
+        }
+    }
+
+    while (level > 1 && helper_next(list, list->head, level - 1) == NULL) {
+        level--;
+    }
+    atomic_store_explicit(&list->level, level, memory_order_relaxed);
+
+    free(node);
+    atomic_store_explicit(&list->size, skl_size(list) - 1, memory_order_relaxed);
+    return (SKL_OK);
+}
+
+void skl_clear(SkipList *list) {
+    if (list == NULL || list->concurrent) {
+        return ;
+    }
+
+    helper_free_nodes(list);
+
+    SKLLink *links = helper_links(list, list->head);
+
+    for (size_t i = 0; i < MAX_LEVEL; ++i) {
+        atomic_store_explicit(&links[i].next, NULL, memory_order_relaxed);
+        links[i].span = 0;
+    }
+
+    atomic_store_explicit(&list->level, 1, memory_order_relaxed);
+    atomic_store_explicit(&list->size, 0, memory_order_relaxed);
+}
+
+
+/* lookup */
+
+void *skl_find(const SkipList *list, const void *key) {
+    if (list == NULL || key == NULL) {
+        return (NULL);
+    }
+
+    SKLNode *node = helper_lower_bound(list, key);
+
+    if (node == NULL || list->cmp(node->data, key) != 0) {
+        return (NULL);
+    }
+
+    return (node->data);
+}
+
+void *skl_lower_bound(const SkipList *list, const void *key) {
+    if (list == NULL || key == NULL) {
+        return (NULL);
+    }
+
+    SKLNode *node = helper_lower_bound(list, key);
+
+    if (node == NULL) {
+        return (NULL);
+    }
+
+    return (node->data);
+}
+
+/* sums the spans of the links taken while searching `key` */
+size_t skl_rank(const SkipList *list, const void *key) {
+    if (list == NULL || key == NULL || list->concurrent) {
+        return ((size_t)-1);
+    }
+
+    SKLNode *x = list->head;
+    size_t traversed = 0;
+
+    for (size_t i = helper_level(list); i-- > 0; ) {
+        SKLNode *next;
+
+        while ((next = helper_next(list, x, i)) != NULL && list->cmp(next->data, key) < 0) {
+            traversed += helper_links(list, x)[i].span;
+            x = next;
+        }
+    }
+
+    return (traversed);
+}
+
+/* takes every link that doesn't overshoot position index + 1 (the head is position 0) */
+void *skl_select(const SkipList *list, size_t index) {
+    if (list == NULL || list->concurrent || index >= skl_size(list)) {
+        return (NULL);
+    }
+
+    SKLNode *x = list->head;
+    size_t target = index + 1;
+    size_t traversed = 0;
+
+    for (size_t i = helper_level(list); i-- > 0; ) {
+        SKLNode *next;
+
+        while ((next = helper_next(list, x, i)) != NULL && traversed + helper_links(list, x)[i].span <= target) {
+            traversed += helper_links(list, x)[i].span;
+            x = next;
+        }
+
+        if (traversed == target) {
+            return (x->data);
+        }
+    }
+
+    return (NULL);
+}
+
+
+/* utilities */
+
+size_t skl_size(const SkipList *list) {
+    if (list == NULL) {
+        return (0);
+    }
+
+    return (atomic_load_explicit(&((SkipList *)list)->size, memory_order_relaxed));
+}
+
+int skl_is_empty(const SkipList *list) {
+    return (skl_size(list) == 0);
+}
+
+
+/* ordered iteration */
+
+SKLCursor skl_cursor_begin(const SkipList *list) {
+    SKLCursor cur = { list, NULL };
+
+    if (list != NULL) {
+        cur.node = helper_next(list, list->head, 0);
+    }
+
+    return (cur);
+}
+
+SKLCursor skl_cursor_lower_bound(const SkipList *list, const void *key) {
+    SKLCursor cur = { list, NULL };
+
+    if (list != NULL && key != NULL) {
+        cur.node = helper_lower_bound(list, key);
+    }
+
+    return (cur);
+}
+
+int skl_cursor_is_end(const SKLCursor *cur) {
+    return (cur == NULL || cur->list == NULL || cur->node == NULL);
+}
+
+int skl_cursor_next(SKLCursor *cur) {
+    if (skl_cursor_is_end(cur)) {
+        return (SKL_ERR);
+    }
+
+    cur->node = helper_next(cur->list, cur->node, 0);
+    return (SKL_OK);
+}
+
+void *skl_cursor_get(const SKLCursor *cur) {
+    if (skl_cursor_is_end(cur)) {
+        return (NULL);
+    }
+
+    return (cur->node->data);
+}
@@ -0,0 +1,329 @@
+/* pthreads are POSIX, not ISO C */
+# define _POSIX_C_SOURCE 200809L
+
+/* implemented interface */
+# include "thread_pool.h"
+
+/* implementation dependencies */
+# include "ws_deque.h"
+# include <stdlib.h>
+# include <stdint.h>
+# include <stdatomic.h>
+# include <pthread.h>
+# include <sched.h>
+
+# define DEQUE_CAPACITY 256 // initial slots of each worker's deque
+# define SPIN_ROUNDS 64     // failed steal rounds before an idle worker goes to sleep
+
+typedef struct TPTask {
+    tp_task_fn fn;
+    void *arg;
+    _Atomic int done;
+} TPTask;
+
+typedef struct TPWorker {
+    struct ThreadPool *pool;
+    size_t index;       // position in pool->workers (0 is the creating thread)
+    WSDeque *deque;     // tasks spawned by this worker
+    pthread_t thread;   // unused for worker 0
+    uint64_t seed;      // xorshift state used to pick steal victims
+} TPWorker;
+
+/* private data */
+typedef struct ThreadPool {
+    size_t nworkers;
+    TPWorker *workers;
+    pthread_t owner;            // creating thread, acts as worker 0
+    _Atomic int stop;           // set by tp_destroy
+    _Atomic size_t sleepers;    // workers blocked (or about to block) on `wake`
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+} ThreadPool;
+
+/* worker the current thread runs as (NULL on threads not started by a pool) */
+/* creating threads aren't recorded here: a thread may create several pools */
+static _Thread_local TPWorker *tls_worker = NULL;
+
+
+/* helpers */
+
+/* returns the worker the current thread acts as in `pool`, NULL if it is none of them */
+static TPWorker *helper_self(ThreadPool *pool) {
+    if (tls_worker != NULL && tls_worker->pool == pool) {
+        return (tls_worker);
+    }
+
+    if (pthread_equal(pthread_self(), pool->owner)) {
+        return (&pool->workers[0]);
+    }
+
+    return (NULL);
+}
+
+static size_t helper_random(TPWorker *w) {
+    w->seed ^= w->seed << 13;
+    w->seed ^= w->seed >> 7;
+    w->seed ^= w->seed << 17;
+
+    return ((size_t)w->seed);
+}
+
+/* own deque first (LIFO, cache-hot), then steal from the others starting at a random victim */
+static TPTask *helper_find_task(TPWorker *w) {
+    TPTask *task = wsd_pop(w->deque);
+
+    if (task != NULL) {
+        return (task);
+    }
+
+    ThreadPool *pool = w->pool;
+    size_t start = helper_random(w) % pool->nworkers;
+
+    for (size_t i = 0; i < pool->nworkers; ++i) {
+        TPWorker *victim = &pool->workers[(start + i) % pool->nworkers];
+
+        if (victim == w) {
+            continue ;
+        }
+
+        task = wsd_steal(victim->deque);
+
+        if (task != NULL) {
+            return (task);
+        }
+    }
+
+    return (NULL);
+}
+
+static int helper_has_work(const ThreadPool *pool) {
+    for (size_t i = 0; i < pool->nworkers; ++i) {
+        if (wsd_size(pool->workers[i].deque) > 0) {
+            return (1);
+        }
+    }
+
+    return (0);
+}
+
+static void helper_run(TPTask *task) {
+    task->fn(task->arg);
+    atomic_store_explicit(&task->done, 1, memory_order_release);
+}
+
+/*
+** blocks the worker until a task is spawned or the pool stops
+** sleepers is raised before re-checking the deques, and spawners check
+** sleepers after pushing (both behind seq_cst fences), so a wakeup can't be lost
+*/
+static void helper_sleep(ThreadPool *pool) {
+    pthread_mutex_lock(&pool->lock);
+    atomic_fetch_add(&pool->sleepers, 1);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    if (!atomic_load(&pool->stop) && !helper_has_work(pool)) {
+        pthread_cond_wait(&pool->wake, &pool->lock);
+    }
+
+    atomic_fetch_sub(&pool->sleepers, 1);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static void *helper_worker_main(void *arg) {
+    TPWorker *w = arg;
+    ThreadPool *pool = w->pool;
+    size_t idle = 0;
+
+    tls_worker = w;
+
+    while (!atomic_load_explicit(&pool->stop, memory_order_acquire)) {
+        TPTask *task = helper_find_task(w);
+
+        if (task != NULL) {
+            helper_run(task);
+            idle = 0;
+            continue ;
+        }
+
+        if (++idle < SPIN_ROUNDS) {
+            sched_yield();
+            continue ;
+        }
+
+        idle = 0;
+        helper_sleep(pool);
+    }
+
+    return (NULL);
+}
+
+/* stops and joins workers [1, count), then frees everything */
+static void helper_teardown(ThreadPool *pool, size_t count) {
+    atomic_store_explicit(&pool->stop, 1, memory_order_release);
+
+    pthread_mutex_lock(&pool->lock);
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t i = 1; i < count; ++i) {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+
+    for (size_t i = 0; i < pool->nworkers; ++i) {
+        wsd_destroy(pool->workers[i].deque);
+    }
+
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->workers);
+    free(pool);
+}
+
+
+/* constructor / destructor */
+
+ThreadPool *tp_create(size_t nworkers) {
+    if (nworkers == 0 || nworkers > SIZE_MAX / sizeof(TPWorker)) {
+        return (NULL);
+    }
+
+    ThreadPool *pool = malloc(sizeof(ThreadPool));
+
+    if (pool == NULL) {
+        return (NULL);
+    }
+
+    pool->workers = calloc(nworkers, sizeof(TPWorker));
+
+    if (pool->workers == NULL) {
+        free(pool);
+        return (NULL);
+    }
+
+    if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+        free(pool->workers);
+        free(pool);
+        return (NULL);
+    }
+
+    if (pthread_cond_init(&pool->wake, NULL) != 0) {
+        pthread_mutex_destroy(&pool->lock);
+        free(pool->workers);
+        free(pool);
+        return (NULL);
+    }
+
+    pool->nworkers = nworkers;
+    pool->owner = pthread_self();
+    atomic_init(&pool->stop, 0);
+    atomic_init(&pool->sleepers, 0);
+
+    for (size_t i = 0; i < nworkers; ++i) {
+        TPWorker *w = &pool->workers[i];
+
+        w->pool = pool;
+        w->index = i;
+        w->seed = (uint64_t)(i + 1) * 0x9E3779B97F4A7C15ULL;
+        w->deque = wsd_create(DEQUE_CAPACITY);
+
+        if (w->deque == NULL) {
+            helper_teardown(pool, 0);
+            return (NULL);
+        }
+    }
+
+    for (size_t i = 1; i < nworkers; ++i) {
+        if (pthread_create(&pool->workers[i].thread, NULL, helper_worker_main, &pool->workers[i]) != 0) {
+            helper_teardown(pool, i);
+            return (NULL);
+        }
+    }
+
+    return (pool);
+}
+
+void tp_destroy(ThreadPool *pool) {
+    if (pool == NULL) {
+        return ;
+    }
+
+    helper_teardown(pool, pool->nworkers);
+}
+
+
+/* fork / join */
+
+TPTask *tp_spawn(ThreadPool *pool, tp_task_fn fn, void *arg) {
+    if (pool == NULL || fn == NULL) {
+        return (NULL);
+    }
+
+    TPWorker *w = helper_self(pool);
+
+    if (w == NULL) {
+        return (NULL);
+    }
+
+    TPTask *task = malloc(sizeof(TPTask));
+
+    if (task == NULL) {
+        return (NULL);
+    }
+
+    task->fn = fn;
+    task->arg = arg;
+    atomic_init(&task->done, 0);
+
+    if (wsd_push(w->deque, task) == WSD_ERR) {
+        free(task);
+        return (NULL);
+    }
+
+    /* wake a sleeping worker, only pay for the lock when someone sleeps */
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&pool->sleepers, memory_order_relaxed) > 0) {
+        pthread_mutex_lock(&pool->lock);
+        pthread_cond_signal(&pool->wake);
+        pthread_mutex_unlock(&pool->lock);
+    }
+
+    return (task);
+}
+
+int tp_sync(ThreadPool *pool, TPTask *task) {
+    if (pool == NULL || task == NULL) {
+        return (TP_ERR);
+    }
+
+    TPWorker *w = helper_self(pool);
+
+    if (w == NULL) {
+        return (TP_ERR);
+    }
+
+    /* help instead of blocking: the task itself is likely still on our deque */
+    while (!atomic_load_explicit(&task->done, memory_order_acquire)) {
+        TPTask *other = helper_find_task(w);
+
+        if (other != NULL) {
+            helper_run(other);
+        } else {
+            sched_yield();
+        }
+    }
+
+    free(task);
+
+    return (TP_OK);
+}
+
+
+/* utilities */
+
+size_t tp_num_workers(const ThreadPool *pool) {
+    if (pool == NULL) {
+        return (0);
+    }
+
+    return (pool->nworkers);
+}
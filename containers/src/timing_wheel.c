@@ -0,0 +1,418 @@
+// implemented interface
+# include "timing_wheel.h"
+
+// implementation dependencies
+# include "pool_allocator.h"
+# include <stdlib.h>
+# include <string.h>
+# include <stdalign.h>
+
+# define SLOT_BITS 8
+# define SLOTS (1 << SLOT_BITS)
+# define SLOT_MASK (SLOTS - 1)
+# define WORDS (SLOTS / 64)              // occupancy bitmap words per level
+# define MAX_LEVELS 8                    // 8 levels of 8 bits cover every 64-bit tick
+# define LEVEL_OVERFLOW MAX_LEVELS       // `level` of a timer in the overflow list
+# define LEVEL_FIRING (MAX_LEVELS + 1)   // `level` of a timer in a batch being fired
+
+/*
+** a timer is linked into a singly linked list through `next`, `pprev` points
+** at whatever points at it (a slot head or the previous `next`), so it can
+** be unlinked in O(1) without knowing its neighbours
+*/
+typedef struct TWTimer {
+    struct TWTimer *next;
+    struct TWTimer **pprev;
+    uint64_t expires;        // expiry tick
+    unsigned char level;     // wheel level, LEVEL_OVERFLOW or LEVEL_FIRING
+    unsigned char slot;      // slot in its level
+    alignas(max_align_t) unsigned char data[];
+} TWTimer;
+
+typedef struct TWLevel {
+    TWTimer *slots[SLOTS];
+    uint64_t occupied[WORDS];   // bit s set iff slots[s] is not empty
+} TWLevel;
+
+/* private data */
+typedef struct TimingWheel {
+    TWLevel *levels;
+    size_t nlevels;
+    TWTimer *overflow;       // timers beyond the top level
+    uint64_t overflow_min;   // earliest expiry in the overflow list (may be stale after a cancel)
+    uint64_t tick;           // next tick to process, every earlier one has fired
+    uint64_t start;          // time of tick 0
+    uint64_t resolution;     // time units per tick
+    size_t size;             // number of pending timers
+    size_t elem_size;
+    PoolAllocator *pool;
+} TimingWheel;
+
+
+/* helpers */
+
+/* number of bits needed to write `x` (0 for 0) */
+static inline unsigned helper_bit_length(uint64_t x) {
+#if defined(__GNUC__)
+    return ((x == 0) ? 0 : 64 - (unsigned)__builtin_clzll(x));
+#else
+    unsigned n = 0;
+
+    while (x != 0) {
+        x >>= 1;
+        ++n;
+    }
+
+    return (n);
+#endif
+}
+
+/* index of the lowest set bit of `x` (not 0) */
+static inline unsigned helper_lowest_bit(uint64_t x) {
+#if defined(__GNUC__)
+    return ((unsigned)__builtin_ctzll(x));
+#else
+    unsigned n = 0;
+
+    while ((x & 1) == 0) {
+        x >>= 1;
+        ++n;
+    }
+
+    return (n);
+#endif
+}
+
+/* mask of the `bits` low bits */
+static inline uint64_t helper_low_mask(unsigned bits) {
+    return ((bits >= 64) ? UINT64_MAX : ((uint64_t)1 << bits) - 1);
+}
+
+/* first occupied slot at or after `from`, SLOTS if none */
+static unsigned helper_next_occupied(const TWLevel *level, unsigned from) {
+    if (from >= SLOTS) {
+        return (SLOTS);
+    }
+
+    unsigned w = from / 64;
+    uint64_t bits = level->occupied[w] & (UINT64_MAX << (from % 64));
+
+    while (bits == 0) {
+        if (++w == WORDS) {
+            return (SLOTS);
+        }
+        bits = level->occupied[w];
+    }
+
+    return (w * 64 + helper_lowest_bit(bits));
+}
+
+static inline void helper_link(TWTimer **head, TWTimer *timer) {
+    timer->next = *head;
+    if (*head != NULL) {
+        (*head)->pprev = &timer->next;
+    }
+    *head = timer;
+    timer->pprev = head;
+}
+
+static inline void helper_unlink(TWTimer *timer) {
+    *timer->pprev = timer->next;
+    if (timer->next != NULL) {
+        timer->next->pprev = timer->pprev;
+    }
+}
+
+/* links the timer under the highest 8-bit digit where its tick differs from the current one */
+static void helper_place(TimingWheel *tw, TWTimer *timer) {
+    uint64_t diff = timer->expires ^ tw->tick;
+    unsigned level = (diff == 0) ? 0 : (helper_bit_length(diff) - 1) / SLOT_BITS;
+
+    if (level >= tw->nlevels) {
+        if (tw->overflow == NULL || timer->expires < tw->overflow_min) {
+            tw->overflow_min = timer->expires;
+        }
+        timer->level = LEVEL_OVERFLOW;
+        helper_link(&tw->overflow, timer);
+        return ;
+    }
+
+    unsigned slot = (unsigned)(timer->expires >> (level * SLOT_BITS)) & SLOT_MASK;
+    TWLevel *wheel = &tw->levels[level];
+
+    timer->level = (unsigned char)level;
+    timer->slot = (unsigned char)slot;
+    helper_link(&wheel->slots[slot], timer);
+    wheel->occupied[slot / 64] |= (uint64_t)1 << (slot % 64);
+}
+
+/* takes the whole list of a slot out of its level */
+static TWTimer *helper_detach_slot(TWLevel *wheel, unsigned slot) {
+    TWTimer *list = wheel->slots[slot];
+
+    wheel->slots[slot] = NULL;
+    wheel->occupied[slot / 64] &= ~((uint64_t)1 << (slot % 64));
+
+    return (list);
+}
+
+/* places again every timer of a detached list (relative to the current tick) */
+static void helper_replace_all(TimingWheel *tw, TWTimer *list) {
+    while (list != NULL) {
+        TWTimer *next = list->next;
+        helper_place(tw, list);
+        list = next;
+    }
+}
+
+/*
+** the next tick at which something happens, from tick `m` on: a level 0
+** slot to fire, a higher slot to cascade (when the digits below it roll over
+** to 0), or the overflow list to go through again; UINT64_MAX if none
+** a slot of level L only holds timers whose digit L is ahead of the current
+** one, so no cascade is ever skipped
+*/
+static uint64_t helper_next_tick(const TimingWheel *tw, uint64_t m) {
+    uint64_t best = UINT64_MAX;
+
+    for (size_t l = 0; l < tw->nlevels; ++l) {
+        unsigned shift = (unsigned)l * SLOT_BITS;
+        unsigned digit = (unsigned)(m >> shift) & SLOT_MASK;
+        unsigned from = digit + ((m & helper_low_mask(shift)) != 0);
+        unsigned slot = helper_next_occupied(&tw->levels[l], from);
+
+        if (slot == SLOTS) {
+            continue ;
+        }
+
+        uint64_t tick = (m & ~helper_low_mask(shift + SLOT_BITS)) + ((uint64_t)slot << shift);
+
+        if (tick < best) {
+            best = tick;
+        }
+    }
+
+    if (tw->overflow != NULL) {
+        /* the top level window holding the earliest overflow timer, not every window up to it */
+        uint64_t span = helper_low_mask((unsigned)tw->nlevels * SLOT_BITS);
+        uint64_t tick = tw->overflow_min & ~span;
+
+        if (tick < m) {
+            tick = (m + span) & ~span;   // stale minimum: next multiple of 256^levels
+        }
+
+        if (tick >= m && tick < best) {
+            best = tick;
+        }
+    }
+
+    return (best);
+}
+
+/* cascades what is due at tick `n`, then fires its level 0 slot, returns the number fired */
+static size_t helper_process(TimingWheel *tw, uint64_t n, tw_fire_fn fire, void *arg) {
+    tw->tick = n;
+
+    unsigned top_bits = (unsigned)tw->nlevels * SLOT_BITS;
+
+    if (tw->overflow != NULL && (n & helper_low_mask(top_bits)) == 0) {
+        TWTimer *list = tw->overflow;
+
+        tw->overflow = NULL;
+        helper_replace_all(tw, list);
+    }
+
+    /* top-down, so a timer can drop several levels at once */
+    for (size_t l = tw->nlevels - 1; l >= 1; --l) {
+        unsigned shift = (unsigned)l * SLOT_BITS;
+
+        if ((n & helper_low_mask(shift)) == 0) {
+            unsigned slot = (unsigned)(n >> shift) & SLOT_MASK;
+            helper_replace_all(tw, helper_detach_slot(&tw->levels[l], slot));
+        }
+    }
+
+    TWTimer *batch = helper_detach_slot(&tw->levels[0], (unsigned)n & SLOT_MASK);
+    size_t fired = 0;
+
+    /* timers scheduled by the callbacks go to later ticks (the last tick there is stays current) */
+    tw->tick = (n == UINT64_MAX) ? n : n + 1;
+
+    if (batch == NULL) {
+        return (0);
+    }
+
+    /* the batch stays a proper list, so a callback can cancel a timer still in it */
+    batch->pprev = &batch;
+    for (TWTimer *t = batch; t != NULL; t = t->next) {
+        t->level = LEVEL_FIRING;
+    }
+
+    while (batch != NULL) {
+        TWTimer *timer = batch;
+
+        helper_unlink(timer);
+        tw->size--;
+        fired++;
+
+        if (fire != NULL) {
+            fire(timer->data, arg);
+        }
+
+        pool_free(tw->pool, timer);
+    }
+
+    return (fired);
+}
+
+
+/* constructor / destructor */
+
+TimingWheel *tw_create(size_t elem_size, uint64_t start, uint64_t resolution, size_t levels) {
+    if (resolution == 0 || levels == 0 || levels > MAX_LEVELS || elem_size > SIZE_MAX - sizeof(TWTimer)) {
+        return (NULL);
+    }
+
+    TimingWheel *tw = malloc(sizeof(TimingWheel));
+
+    if (tw == NULL) {
+        return (NULL);
+    }
+
+    tw->levels = calloc(levels, sizeof(TWLevel));
+    tw->pool = pool_create(sizeof(TWTimer) + elem_size);
+
+    if (tw->levels == NULL || tw->pool == NULL) {
+        free(tw->levels);
+        pool_destroy(tw->pool);
+        free(tw);
+        return (NULL);
+    }
+
+    tw->nlevels = levels;
+    tw->overflow = NULL;
+    tw->overflow_min = UINT64_MAX;
+    tw->tick = 0;
+    tw->start = start;
+    tw->resolution = resolution;
+    tw->size = 0;
+    tw->elem_size = elem_size;
+
+    return (tw);
+}
+
+void tw_destroy(TimingWheel *tw) {
+    if (tw == NULL) {
+        return ;
+    }
+
+    /* every timer lives in the pool */
+    pool_destroy(tw->pool);
+    free(tw->levels);
+    free(tw);
+}
+
+
+/* modifiers */
+
+TWTimer *tw_schedule(TimingWheel *tw, uint64_t expires, const void *elem) {
+    if (tw == NULL || (elem == NULL && tw->elem_size > 0)) {
+        return (NULL);
+    }
+
+    TWTimer *timer = pool_alloc(tw->pool);
+
+    if (timer == NULL) {
+        return (NULL);
+    }
+
+    /* rounded up: a timer never fires before its time */
+    uint64_t tick = 0;
+
+    if (expires > tw->start) {
+        uint64_t elapsed = expires - tw->start;
+        tick = elapsed / tw->resolution + (elapsed % tw->resolution != 0);
+    }
+
+    timer->expires = (tick < tw->tick) ? tw->tick : tick;
+    if (tw->elem_size > 0) {
+        memcpy(timer->data, elem, tw->elem_size);
+    }
+
+    helper_place(tw, timer);
+    tw->size++;
+
+    return (timer);
+}
+
+int tw_cancel(TimingWheel *tw, TWTimer *timer) {
+    if (tw == NULL || timer == NULL) {
+        return (TW_ERR);
+    }
+
+    helper_unlink(timer);
+
+    if (timer->level < tw->nlevels) {
+        TWLevel *wheel = &tw->levels[timer->level];
+
+        if (wheel->slots[timer->slot] == NULL) {
+            wheel->occupied[timer->slot / 64] &= ~((uint64_t)1 << (timer->slot % 64));
+        }
+    }
+
+    tw->size--;
+    pool_free(tw->pool, timer);
+
+    return (TW_OK);
+}
+
+size_t tw_advance(TimingWheel *tw, uint64_t now, tw_fire_fn fire, void *arg) {
+    if (tw == NULL || now < tw->start) {
+        return (0);
+    }
+
+    uint64_t last = (now - tw->start) / tw->resolution;   // last tick to process
+    size_t fired = 0;
+
+    while (tw->tick <= last) {
+        uint64_t n = (tw->size == 0) ? UINT64_MAX : helper_next_tick(tw, tw->tick);
+
+        if (n > last) {
+            /* nothing is due before `last`: jump over the empty ticks */
+            tw->tick = last + 1;
+            break ;
+        }
+
+        fired += helper_process(tw, n, fire, arg);
+
+        /* tw->tick saturates on the last tick there is, instead of wrapping to 0 */
+        if (n == UINT64_MAX) {
+            break ;
+        }
+    }
+
+    return (fired);
+}
+
+
+/* lookup */
+
+void *tw_value(const TWTimer *timer) {
+    if (timer == NULL) {
+        return (NULL);
+    }
+
+    return ((void *)timer->data);
+}
+
+size_t tw_size(const TimingWheel *tw) {
+    if (tw == NULL) {
+        return (0);
+    }
+
+    return (tw->size);
+}
+
+int tw_is_empty(const TimingWheel *tw) {
+    return (tw == NULL || tw->size == 0);
+}
@@ -0,0 +1,197 @@
+// implemented interface
+# include "topk.h"
+
+// implementation dependencies
+# include <stdlib.h>
+# include <string.h>
+# include <stdint.h>
+
+/* private data */
+typedef struct TopK {
+    unsigned char *data;   // min-heap of the kept elements, K slots
+    size_t size;
+    size_t capacity;       // K
+    size_t elem_size;
+    topk_cmp_fn cmp;
+    void *moving;          // element carried by topk_sorted's sift-downs
+} TopK;
+
+
+/* helpers */
+
+/* copies one element, with fixed-size copies for the common sizes (as in heap.c) */
+static inline void helper_copy(void *dst, const void *src, size_t elem_size) {
+    switch (elem_size) {
+        case 4:
+            memcpy(dst, src, 4);
+            break ;
+        case 8:
+            memcpy(dst, src, 8);
+            break ;
+        case 16:
+            memcpy(dst, src, 16);
+            break ;
+        default:
+            memcpy(dst, src, elem_size);
+            break ;
+    }
+}
+
+/* moves `elem` up from the hole at `i` of the min-heap `base` */
+static void helper_sift_up(unsigned char *base, size_t i, const void *elem, size_t es, topk_cmp_fn cmp) {
+    while (i > 0) {
+        size_t parent_i = (i - 1) / 2;
+
+        if (cmp(elem, base + parent_i * es) >= 0) {
+            break ;
+        }
+
+        helper_copy(base + i * es, base + parent_i * es, es);
+        i = parent_i;
+    }
+
+    helper_copy(base + i * es, elem, es);
+}
+
+/* moves `elem` down from the hole at `i` of the min-heap `base` of `n` elements */
+/* `elem` must not live in `base` */
+static void helper_sift_down(unsigned char *base, size_t n, size_t i, const void *elem, size_t es, topk_cmp_fn cmp) {
+    size_t half = n / 2;   // nodes [0, half) have at least one child
+
+    while (i < half) {
+        size_t child_i = 2 * i + 1;
+
+        if (child_i + 1 < n && cmp(base + (child_i + 1) * es, base + child_i * es) < 0) {
+            ++child_i;
+        }
+
+        if (cmp(base + child_i * es, elem) >= 0) {
+            break ;
+        }
+
+        helper_copy(base + i * es, base + child_i * es, es);
+        i = child_i;
+    }
+
+    helper_copy(base + i * es, elem, es);
+}
+
+
+/* constructor / destructor */
+
+TopK *topk_create(size_t k, size_t elem_size, topk_cmp_fn cmp) {
+    if (k == 0 || elem_size == 0 || cmp == NULL || k > SIZE_MAX / elem_size) {
+        return (NULL);
+    }
+
+    TopK *topk = malloc(sizeof(TopK));
+
+    if (topk == NULL) {
+        return (NULL);
+    }
+
+    topk->data = malloc(k * elem_size);
+    topk->moving = malloc(elem_size);
+
+    if (topk->data == NULL || topk->moving == NULL) {
+        free(topk->data);
+        free(topk->moving);
+        free(topk);
+        return (NULL);
+    }
+
+    topk->size = 0;
+    topk->capacity = k;
+    topk->elem_size = elem_size;
+    topk->cmp = cmp;
+
+    return (topk);
+}
+
+void topk_destroy(TopK *topk) {
+    if (topk != NULL) {
+        free(topk->data);
+        free(topk->moving);
+        free(topk);
+    }
+}
+
+
+/* modifiers */
+
+int topk_offer(TopK *topk, const void *elem) {
+    if (topk == NULL || elem == NULL) {
+        return (TOPK_ERR);
+    }
+
+    if (topk->size < topk->capacity) {
+        helper_sift_up(topk->data, topk->size, elem, topk->elem_size, topk->cmp);
+        topk->size++;
+        return (TOPK_OK);
+    }
+
+    /* the common case: not above the threshold */
+    if (topk->cmp(elem, topk->data) <= 0) {
+        return (TOPK_REJECTED);
+    }
+
+    /* the root is dropped, `elem` takes its place */
+    helper_sift_down(topk->data, topk->size, 0, elem, topk->elem_size, topk->cmp);
+    return (TOPK_OK);
+}
+
+void topk_clear(TopK *topk) {
+    if (topk != NULL) {
+        topk->size = 0;
+    }
+}
+
+
+/* lookup */
+
+const void *topk_threshold(const TopK *topk) {
+    if (topk == NULL || topk->size == 0) {
+        return (NULL);
+    }
+
+    return (topk->data);
+}
+
+/*
+** heap sort on a copy: the root (the smallest) is swapped to the end of the
+** shrinking heap each round, so the copy ends up largest first
+*/
+size_t topk_sorted(const TopK *topk, void *dst) {
+    if (topk == NULL || dst == NULL || topk->size == 0) {
+        return (0);
+    }
+
+    size_t es = topk->elem_size;
+    unsigned char *base = dst;
+
+    memcpy(base, topk->data, topk->size * es);
+
+    for (size_t n = topk->size; n > 1; --n) {
+        helper_copy(topk->moving, base + (n - 1) * es, es);
+        helper_copy(base + (n - 1) * es, base, es);
+        helper_sift_down(base, n - 1, 0, topk->moving, es, topk->cmp);
+    }
+
+    return (topk->size);
+}
+
+size_t topk_size(const TopK *topk) {
+    if (topk == NULL) {
+        return (0);
+    }
+
+    return (topk->size);
+}
+
+size_t topk_capacity(const TopK *topk) {
+    if (topk == NULL) {
+        return (0);
+    }
+
+    return (topk->capacity);
+}
@@ -0,0 +1,421 @@
+/* implemented interface */
+# include "unrolled_list.h"
+
+/* implementation dependencies */
+# include "pool_allocator.h"
+# include <stdlib.h>
+# include <string.h>
+# include <stdint.h>
+# include <stdalign.h>
+# include <stddef.h>
+
+# define NODE_BYTES 512     // target size of the element array of one node
+# define MIN_NODE_ELEMS 8   // lower bound of elements per node (large elements)
+
+/* node: up to `node_cap` elements stored contiguously, the first `count` are in use */
+typedef struct ULNode {
+    struct ULNode *prev;
+    struct ULNode *next;
+    size_t count;
+    alignas(max_align_t) unsigned char data[];
+} ULNode;
+
+/* private data */
+typedef struct UnrolledList {
+    size_t size;          // number of elements
+    size_t elem_size;     // size of each element in bytes
+    size_t node_cap;      // elements per node
+    ULNode *head;         // first node, NULL when empty
+    ULNode *tail;         // last node, NULL when empty
+    PoolAllocator *pool;  // node storage (slabs + free list)
+    ULNode *finger;       // last node reached by index, NULL when unknown
+    size_t finger_start;  // index of the first element of `finger`
+} UnrolledList;
+
+
+/* helpers */
+
+/* returns a pointer to the slot `offset` of `node` */
+static inline void *helper_at(const UnrolledList *list, ULNode *node, size_t offset) {
+    return (node->data + offset * list->elem_size);
+}
+
+/* allocates an empty node and links it between `prev` and `next` (either may be NULL) */
+/* return NULL to indicate failure */
+static ULNode *helper_new_node(UnrolledList *list, ULNode *prev, ULNode *next) {
+    ULNode *node = pool_alloc(list->pool);
+
+    if (node == NULL) {
+        return (NULL);
+    }
+
+    node->count = 0;
+    node->prev = prev;
+    node->next = next;
+
+    if (prev != NULL) {
+        prev->next = node;
+    } else {
+        list->head = node;
+    }
+
+    if (next != NULL) {
+        next->prev = node;
+    } else {
+        list->tail = node;
+    }
+
+    return (node);
+}
+
+/* unlinks `node` and gives it back to the pool */
+static void helper_free_node(UnrolledList *list, ULNode *node) {
+    if (node->prev != NULL) {
+        node->prev->next = node->next;
+    } else {
+        list->head = node->next;
+    }
+
+    if (node->next != NULL) {
+        node->next->prev = node->prev;
+    } else {
+        list->tail = node->prev;
+    }
+
+    if (list->finger == node) {
+        list->finger = NULL;
+    }
+
+    pool_free(list->pool, node);
+}
+
+/* returns the node holding the element at `index` (< size) and stores the index of */
+/* its first element in `start`, the walk starts from head, tail or finger, whichever is closest */
+static ULNode *helper_find(UnrolledList *list, size_t index, size_t *start) {
+    ULNode *node = list->head;
+    size_t first = 0;
+    size_t distance = index;
+    size_t tail_start = list->size - list->tail->count;
+
+    /* or from the tail */
+    if (index >= tail_start || list->size - index < distance) {
+        node = list->tail;
+        first = tail_start;
+        distance = (index >= tail_start) ? 0 : tail_start - index;
+    }
+
+    /* or from the finger */
+    if (list->finger != NULL) {
+        size_t fs = list->finger_start;
+        size_t finger_distance = (fs > index) ? fs - index : index - fs;
+
+        if (finger_distance < distance) {
+            node = list->finger;
+            first = fs;
+        }
+    }
+
+    /* whole nodes are skipped */
+    while (index >= first + node->count) {
+        first += node->count;
+        node = node->next;
+    }
+
+    while (index < first) {
+        node = node->prev;
+        first -= node->count;
+    }
+
+    list->finger = node;
+    list->finger_start = first;
+
+    *start = first;
+    return (node);
+}
+
+/* copies `src` into slot `offset` of `node` (which isn't full), shifting the slots after it */
+static void helper_insert_into(UnrolledList *list, ULNode *node, size_t offset, const void *src) {
+    memmove(helper_at(list, node, offset + 1), helper_at(list, node, offset),
+        (node->count - offset) * list->elem_size);
+    memcpy(helper_at(list, node, offset), src, list->elem_size);
+    node->count++;
+}
+
+/* appends the elements of `right` to `left` (they fit) and frees `right` */
+static void helper_merge(UnrolledList *list, ULNode *left, ULNode *right) {
+    memcpy(helper_at(list, left, left->count), right->data, right->count * list->elem_size);
+    left->count += right->count;
+    helper_free_node(list, right);
+}
+
+/* keeps the finger start right when an element is inserted at `index` into `node` */
+static void helper_finger_inserted(UnrolledList *list, ULNode *node, size_t index) {
+    if (list->finger != NULL && list->finger != node && list->finger_start >= index) {
+        list->finger_start++;
+    }
+}
+
+/* keeps the finger start right when the element at `index` is removed from `node` */
+static void helper_finger_removed(UnrolledList *list, ULNode *node, size_t index) {
+    if (list->finger != NULL && list->finger != node && list->finger_start > index) {
+        list->finger_start--;
+    }
+}
+
+
+/* constructor / destructor */
+
+/* elem_size must be greater than 0 */
+/* return NULL to indicate construction failure */
+UnrolledList *ul_create(size_t elem_size) {
+    if (elem_size == 0 || elem_size > (SIZE_MAX - sizeof(ULNode)) / MIN_NODE_ELEMS) {
+        return (NULL);
+    }
+
+    UnrolledList *list = malloc(sizeof(UnrolledList));
+
+    if (list == NULL) {
+        return (NULL);
+    }
+
+    list->node_cap = NODE_BYTES / elem_size;
+    if (list->node_cap < MIN_NODE_ELEMS) {
+        list->node_cap = MIN_NODE_ELEMS;
+    }
+
+    list->pool = pool_create(sizeof(ULNode) + list->node_cap * elem_size);
+    if (list->pool == NULL) {
+        free(list);
+        return (NULL);
+    }
+
+    list->size = 0;
+    list->elem_size = elem_size;
+    list->head = NULL;
+    list->tail = NULL;
+    list->finger = NULL;
+    list->finger_start = 0;
+
+    return (list);
+}
+
+void ul_destroy(UnrolledList *list) {
+    if (list == NULL) {
+        return ;
+    }
+
+    /* reclaim every node at once */
+    pool_destroy(list->pool);
+    free(list);
+}
+
+
+/* insertion */
+
+int ul_push_front(UnrolledList *list, const void *src) {
+    if (list == NULL || src == NULL) {
+        return (UL_ERR);
+    }
+
+    ULNode *node = list->head;
+
+    if (node == NULL || node->count == list->node_cap) {
+        node = helper_new_node(list, NULL, list->head);
+
+        if (node == NULL) {
+            return (UL_ERR);
+        }
+    }
+
+    helper_insert_into(list, node, 0, src);
+    helper_finger_inserted(list, node, 0);
+    list->size++;
+    return (UL_OK);
+}
+
+int ul_push_back(UnrolledList *list, const void *src) {
+    if (list == NULL || src == NULL) {
+        return (UL_ERR);
+    }
+
+    ULNode *node = list->tail;
+
+    /* appending fills nodes completely */
+    if (node == NULL || node->count == list->node_cap) {
+        node = helper_new_node(list, list->tail, NULL);
+
+        if (node == NULL) {
+            return (UL_ERR);
+        }
+    }
+
+    memcpy(helper_at(list, node, node->count), src, list->elem_size);
+    node->count++;
+    list->size++;
+    return (UL_OK);
+}
+
+/* index must be within the range [0, size] */
+int ul_insert_at(UnrolledList *list, size_t index, const void *src) {
+    if (list == NULL || src == NULL || index > list->size) {
+        return (UL_ERR);
+    }
+
+    if (index == list->size) {
+        return (ul_push_back(list, src));
+    }
+
+    if (index == 0) {
+        return (ul_push_front(list, src));
+    }
+
+    size_t start;
+    ULNode *node = helper_find(list, index, &start);
+    size_t offset = index - start;
+
+    /* split a full node: its upper half moves to a new node right after it */
+    if (node->count == list->node_cap) {
+        ULNode *right = helper_new_node(list, node, node->next);
+
+        if (right == NULL) {
+            return (UL_ERR);
+        }
+
+        size_t half = list->node_cap / 2;
+
+        memcpy(right->data, helper_at(list, node, half), (node->count - half) * list->elem_size);
+        right->count = node->count - half;
+        node->count = half;
+
+        if (offset > half) {
+            node = right;
+            offset -= half;
+        }
+    }
+
+    helper_insert_into(list, node, offset, src);
+    helper_finger_inserted(list, node, index);
+    list->size++;
+    return (UL_OK);
+}
+
+
+/* deletion */
+
+int ul_pop_front(UnrolledList *list) {
+    if (list == NULL || list->size == 0) {
+        return (UL_ERR);
+    }
+
+    return (ul_remove_at(list, 0));
+}
+
+int ul_pop_back(UnrolledList *list) {
+    if (list == NULL || list->size == 0) {
+        return (UL_ERR);
+    }
+
+    return (ul_remove_at(list, list->size - 1));
+}
+
+/* index must be in the range [0, size - 1] */
+int ul_remove_at(UnrolledList *list, size_t index) {
+    if (list == NULL || index >= list->size) {
+        return (UL_ERR);
+    }
+
+    size_t start;
+    ULNode *node = helper_find(list, index, &start);
+    size_t offset = index - start;
+
+    memmove(helper_at(list, node, offset), helper_at(list, node, offset + 1),
+        (node->count - offset - 1) * list->elem_size);
+    node->count--;
+    list->size--;
+    helper_finger_removed(list, node, index);
+
+    if (node->count == 0) {
+        helper_free_node(list, node);
+        return (UL_OK);
+    }
+
+    /* under half full: merge with a neighbour if both fit in one node */
+    /* (so two adjacent nodes always hold more than one node's worth on average) */
+    if (node->count < list->node_cap / 2) {
+        if (node->next != NULL && node->count + node->next->count <= list->node_cap) {
+            helper_merge(list, node, node->next);
+        } else if (node->prev != NULL && node->prev->count + node->count <= list->node_cap) {
+            helper_merge(list, node->prev, node);
+        }
+    }
+
+    return (UL_OK);
+}
+
+
+/* access */
+
+void *ul_front(const UnrolledList *list) {
+    if (list == NULL || list->size == 0) {
+        return (NULL);
+    }
+
+    return (list->head->data);
+}
+
+void *ul_back(const UnrolledList *list) {
+    if (list == NULL || list->size == 0) {
+        return (NULL);
+    }
+
+    return (helper_at(list, list->tail, list->tail->count - 1));
+}
+
+void *ul_get(UnrolledList *list, size_t index) {
+    if (list == NULL || index >= list->size) {
+        return (NULL);
+    }
+
+    size_t start;
+    ULNode *node = helper_find(list, index, &start);
+
+    return (helper_at(list, node, index - start));
+}
+
+
+/* utilities */
+
+size_t ul_size(const UnrolledList *list) {
+    if (list == NULL) {
+        return (0);
+    }
+
+    return (list->size);
+}
+
+int ul_is_empty(const UnrolledList *list) {
+    return (list == NULL || list->size == 0);
+}
+
+size_t ul_node_capacity(const UnrolledList *list) {
+    if (list == NULL) {
+        return (0);
+    }
+
+    return (list->node_cap);
+}
+
+/* clears the list, after this call, the list->size is 0 */
+void ul_clear(UnrolledList *list) {
+    if (list == NULL) {
+        return ;
+    }
+
+    /* reclaims all nodes in bulk (no per-node walk) */
+    pool_clear(list->pool);
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->finger = NULL;
+    list->size = 0;
+}
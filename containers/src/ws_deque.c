@@ -0,0 +1,230 @@
+/* implemented interface */
+# include "ws_deque.h"
+
+/* implementation dependencies */
+# include <stdlib.h>
+# include <stdint.h>
+# include <stdatomic.h>
+
+# define MIN_CAPACITY 16
+
+/*
+** circular buffer of item pointers
+** when the owner grows the deque, the old buffer can't be freed right away
+** (a thief may still be reading from it), so buffers are chained through
+** `prev` and released together in wsd_destroy
+*/
+typedef struct WSBuffer {
+    size_t capacity;            // number of slots (power of two)
+    struct WSBuffer *prev;      // previous (smaller) buffer, NULL for the first one
+    _Atomic(void *) slots[];
+} WSBuffer;
+
+/* private data */
+/* top and bottom only ever grow (mod capacity gives the slot) */
+typedef struct WSDeque {
+    _Atomic int64_t top;        // next slot to steal from (thieves)
+    _Atomic int64_t bottom;     // next free slot (owner)
+    _Atomic(WSBuffer *) buffer;
+} WSDeque;
+
+
+/* helpers */
+
+static WSBuffer *helper_new_buffer(size_t capacity, WSBuffer *prev) {
+    if (capacity > (SIZE_MAX - sizeof(WSBuffer)) / sizeof(void *)) {
+        return (NULL);
+    }
+
+    WSBuffer *buf = malloc(sizeof(WSBuffer) + capacity * sizeof(void *));
+
+    if (buf == NULL) {
+        return (NULL);
+    }
+
+    buf->capacity = capacity;
+    buf->prev = prev;
+
+    return (buf);
+}
+
+static inline _Atomic(void *) *helper_slot(WSBuffer *buf, int64_t i) {
+    return (&buf->slots[(size_t)i & (buf->capacity - 1)]);
+}
+
+/* copies items [top, bottom) into a buffer twice as big */
+/* return NULL to indicate failure (the old buffer stays in use) */
+static WSBuffer *helper_grow(WSBuffer *old, int64_t top, int64_t bottom) {
+    if (old->capacity > SIZE_MAX / 2) {
+        return (NULL);
+    }
+
+    WSBuffer *buf = helper_new_buffer(old->capacity * 2, old);
+
+    if (buf == NULL) {
+        return (NULL);
+    }
+
+    for (int64_t i = top; i < bottom; ++i) {
+        void *item = atomic_load_explicit(helper_slot(old, i), memory_order_relaxed);
+        atomic_store_explicit(helper_slot(buf, i), item, memory_order_relaxed);
+    }
+
+    return (buf);
+}
+
+
+/* constructor / destructor */
+
+WSDeque *wsd_create(size_t initial_capacity) {
+    size_t capacity = MIN_CAPACITY;
+
+    while (capacity < initial_capacity) {
+        if (capacity > SIZE_MAX / 2) {
+            return (NULL);
+        }
+        capacity *= 2;
+    }
+
+    WSDeque *dq = malloc(sizeof(WSDeque));
+
+    if (dq == NULL) {
+        return (NULL);
+    }
+
+    WSBuffer *buf = helper_new_buffer(capacity, NULL);
+
+    if (buf == NULL) {
+        free(dq);
+        return (NULL);
+    }
+
+    atomic_init(&dq->top, 0);
+    atomic_init(&dq->bottom, 0);
+    atomic_init(&dq->buffer, buf);
+
+    return (dq);
+}
+
+void wsd_destroy(WSDeque *dq) {
+    if (dq == NULL) {
+        return ;
+    }
+
+    WSBuffer *buf = atomic_load_explicit(&dq->buffer, memory_order_relaxed);
+
+    while (buf != NULL) {
+        WSBuffer *prev = buf->prev;
+        free(buf);
+        buf = prev;
+    }
+
+    free(dq);
+}
+
+
+/* owner operations */
+
+int wsd_push(WSDeque *dq, void *item) {
+    if (dq == NULL || item == NULL) {
+        return (WSD_ERR);
+    }
+
+    int64_t b = atomic_load_explicit(&dq->bottom, memory_order_relaxed);
+    int64_t t = atomic_load_explicit(&dq->top, memory_order_acquire);
+    WSBuffer *buf = atomic_load_explicit(&dq->buffer, memory_order_relaxed);
+
+    if (b - t > (int64_t)buf->capacity - 1) {
+        buf = helper_grow(buf, t, b);
+
+        if (buf == NULL) {
+            return (WSD_ERR);
+        }
+
+        atomic_store_explicit(&dq->buffer, buf, memory_order_release);
+    }
+
+    atomic_store_explicit(helper_slot(buf, b), item, memory_order_relaxed);
+
+    /* the item must be visible before thieves can see the new bottom */
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+
+    return (WSD_OK);
+}
+
+void *wsd_pop(WSDeque *dq) {
+    if (dq == NULL) {
+        return (NULL);
+    }
+
+    int64_t b = atomic_load_explicit(&dq->bottom, memory_order_relaxed) - 1;
+    WSBuffer *buf = atomic_load_explicit(&dq->buffer, memory_order_relaxed);
+
+    /* reserve the bottom slot before looking at top (pairs with the thieves' fence) */
+    atomic_store_explicit(&dq->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    int64_t t = atomic_load_explicit(&dq->top, memory_order_relaxed);
+
+    if (t > b) {
+        /* empty */
+        atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+        return (NULL);
+    }
+
+    void *item = atomic_load_explicit(helper_slot(buf, b), memory_order_relaxed);
+
+    if (t == b) {
+        /* last item: race against thieves for it */
+        if (!atomic_compare_exchange_strong_explicit(&dq->top, &t, t + 1,
+                memory_order_seq_cst, memory_order_relaxed)) {
+            item = NULL;
+        }
+        atomic_store_explicit(&dq->bottom, b + 1, memory_order_relaxed);
+    }
+
+    return (item);
+}
+
+
+/* thief operation */
+
+void *wsd_steal(WSDeque *dq) {
+    if (dq == NULL) {
+        return (NULL);
+    }
+
+    int64_t t = atomic_load_explicit(&dq->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t b = atomic_load_explicit(&dq->bottom, memory_order_acquire);
+
+    if (t >= b) {
+        return (NULL);
+    }
+
+    WSBuffer *buf = atomic_load_explicit(&dq->buffer, memory_order_acquire);
+    void *item = atomic_load_explicit(helper_slot(buf, t), memory_order_relaxed);
+
+    /* another thief (or the owner popping the last item) got there first */
+    if (!atomic_compare_exchange_strong_explicit(&dq->top, &t, t + 1,
+            memory_order_seq_cst, memory_order_relaxed)) {
+        return (NULL);
+    }
+
+    return (item);
+}
+
+
+/* utilities */
+
+size_t wsd_size(const WSDeque *dq) {
+    if (dq == NULL) {
+        return (0);
+    }
+
+    int64_t b = atomic_load_explicit(&((WSDeque *)dq)->bottom, memory_order_relaxed);
+    int64_t t = atomic_load_explicit(&((WSDeque *)dq)->top, memory_order_relaxed);
+
+    return (b > t ? (size_t)(b - t) : 0);
+}
@@ -0,0 +1,60 @@
+#include "deque.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define N 2000000  // random operations
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    Deque *dq = dq_create(sizeof(long));
+    assert(dq != NULL);
+
+    /* reference: plain array used as a window [lo, hi) centred in the buffer */
+    long *ref = malloc(sizeof(long) * (2 * N + 1));
+    assert(ref != NULL);
+    size_t lo = N, hi = N;
+
+    for (long i = 0; i < N; ++i) {
+        switch (rand() % 5) {
+            case 0:
+            case 1:
+                assert(dq_push_back(dq, &i) == DQ_OK);
+                ref[hi++] = i;
+                break ;
+            case 2:
+                assert(dq_push_front(dq, &i) == DQ_OK);
+                ref[--lo] = i;
+                break ;
+            case 3:
+                if (hi > lo) {
+                    assert(*(long *)dq_front(dq) == ref[lo]);
+                    assert(dq_pop_front(dq) == DQ_OK);
+                    lo++;
+                }
+                break ;
+            default:
+                if (hi > lo) {
+                    assert(*(long *)dq_back(dq) == ref[hi - 1]);
+                    assert(dq_pop_back(dq) == DQ_OK);
+                    hi--;
+                }
+                break ;
+        }
+        assert(dq_size(dq) == hi - lo);
+    }
+
+    /* random access over the final content */
+    for (size_t i = 0; i < 100000 && hi > lo; ++i) {
+        size_t index = (size_t)rand() % (hi - lo);
+        assert(*(long *)dq_get(dq, index) == ref[lo + index]);
+    }
+
+    printf("✓ deque stress test passed: %d random ops, final size = %zu\n", N, dq_size(dq));
+
+    free(ref);
+    dq_destroy(dq);
+    return EXIT_SUCCESS;
+}
@@ -4,6 +4,11 @@
 #include <stdlib.h>
 #include <time.h>
 
+/* orders by key only (value / 1e6), so stability is observable */
+static int cmp_key(const void *a, const void *b) {
+    return (*(const int *)a / 1000000 - *(const int *)b / 1000000);
+}
+
 int main(void) {
     srand((unsigned)time(NULL));
 
@@ -46,6 +51,142 @@ int main(void) {
         assert(dl_remove_at(list, index) == DL_OK);
     }
 
+    // index-based sequential loop (linear thanks to the finger)
+    int prev_value = -1;
+    for (size_t i = 0; i < dl_size(list); ++i) {
+        int *value = (int *)dl_get(list, i);
+        assert(value != NULL);
+        if (*value == head || *value == mid || *value == tail) {
+            continue ;  // markers inserted above
+        }
+        assert(*value > prev_value);
+        prev_value = *value;
+    }
+
+    // filter out odd values in one linear pass with a cursor
+    size_t before = dl_size(list), removed = 0;
+    DLCursor cur = dl_cursor_begin(list);
+    while (!dl_cursor_is_end(&cur)) {
+        if (*(int *)dl_cursor_get(&cur) % 2 != 0) {
+            assert(dl_cursor_erase(&cur) == DL_OK);
+            removed++;
+        } else {
+            assert(dl_cursor_next(&cur) == DL_OK);
+        }
+    }
+    assert(dl_size(list) == before - removed);
+
+    // random edits mixed with index access, checked against a plain array
+    dl_clear(list);
+    int ref[4096];
+    size_t ref_size = 0;
+    for (size_t i = 0; i < 200000; ++i) {
+        int op = rand() % 4;
+        if (op == 0 && ref_size < 4096) {
+            size_t index = rand() % (ref_size + 1);
+            int val = (int)i;
+            assert(dl_insert_at(list, index, &val) == DL_OK);
+            for (size_t j = ref_size; j > index; --j) {
+                ref[j] = ref[j - 1];
+            }
+            ref[index] = val;
+            ref_size++;
+        } else if (op == 1 && ref_size > 0) {
+            size_t index = rand() % ref_size;
+            assert(dl_remove_at(list, index) == DL_OK);
+            for (size_t j = index; j + 1 < ref_size; ++j) {
+                ref[j] = ref[j + 1];
+            }
+            ref_size--;
+        } else if (ref_size > 0) {
+            size_t index = rand() % ref_size;
+            assert(*(int *)dl_get(list, index) == ref[index]);
+        }
+    }
+    assert(dl_size(list) == ref_size);
+    for (size_t i = 0; i < ref_size; ++i) {
+        assert(*(int *)dl_get(list, i) == ref[i]);
+    }
+
+    // incremental compaction interleaved with random edits
+    int status;
+    int next_value = 1 << 30;
+    do {
+        status = dl_compact_step(list, 64);
+        assert(status != DL_ERR);
+        if (ref_size > 0) {
+            size_t index = rand() % ref_size;
+            assert(dl_remove_at(list, index) == DL_OK);
+            for (size_t j = index; j + 1 < ref_size; ++j) {
+                ref[j] = ref[j + 1];
+            }
+            ref_size--;
+        }
+        size_t index = rand() % (ref_size + 1);
+        assert(dl_insert_at(list, index, &next_value) == DL_OK);
+        for (size_t j = ref_size; j > index; --j) {
+            ref[j] = ref[j - 1];
+        }
+        ref[index] = next_value++;
+        ref_size++;
+    } while (status == DL_PENDING);
+    assert(dl_compact(list) == DL_OK);
+    assert(dl_size(list) == ref_size);
+    for (size_t i = 0; i < ref_size; ++i) {
+        assert(*(int *)dl_get(list, i) == ref[i]);
+    }
+
+    // sort a large random list in place, checking order and stability
+    dl_clear(list);
+    for (size_t i = 0; i < N; ++i) {
+        int val = (rand() % 1000) * 1000000 + (int)i % 1000000;  // key * 1e6 + insertion order
+        assert(dl_push_back(list, &val) == DL_OK);
+    }
+    assert(dl_sort(list, cmp_key) == DL_OK);
+    assert(dl_size(list) == N);
+    int prev_sorted = -1;
+    for (size_t i = 0; i < N; ++i) {
+        int value = *(int *)dl_get(list, i);
+        assert(value / 1000000 >= prev_sorted / 1000000);
+        if (value / 1000000 == prev_sorted / 1000000) {
+            assert(value % 1000000 > prev_sorted % 1000000);  // stable
+        }
+        prev_sorted = value;
+    }
+
+    // split in two with a splice, then merge the halves back (no element copies)
+    DoublyList *other = dl_create(sizeof(int));
+    DLCursor first = dl_cursor_begin(list);
+    for (size_t i = 0; i < N / 2; ++i) {
+        dl_cursor_next(&first);
+    }
+    DLCursor last = dl_cursor_last(list);
+    dl_cursor_next(&last);
+    DLCursor pos = dl_cursor_begin(other);
+    assert(dl_splice(&pos, &first, &last, N - N / 2) == DL_OK);
+    assert(dl_size(list) == N / 2 && dl_size(other) == N - N / 2);
+    assert(dl_merge(list, other, cmp_key) == DL_OK);
+    assert(dl_size(list) == N && dl_is_empty(other));
+    prev_sorted = -1;
+    for (size_t i = 0; i < N; ++i) {
+        int value = *(int *)dl_get(list, i);
+        assert(value / 1000000 >= prev_sorted / 1000000);
+        prev_sorted = value;
+    }
+    dl_destroy(other);
+
+    // round trip through a plain array: one walk out, one block back in
+    int *array = malloc(N * sizeof(int));
+    assert(array != NULL);
+    assert(dl_to_array(list, array, N) == N);
+    DoublyList *copy = dl_from_array(sizeof(int), array, N);
+    assert(copy != NULL && dl_size(copy) == N);
+    for (size_t i = 0; i < N; ++i) {
+        assert(*(int *)dl_get(copy, i) == array[i]);
+    }
+    dl_destroy(copy);
+    free(array);
+
     printf("✅ doublyList stress test passed. Final size = %zu\n", dl_size(list));
 
     dl_destroy(list);
@@ -0,0 +1,91 @@
+#include "epoch_reclaim.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define READERS 3
+#define SWAPS 200000   // objects published then retired by the writer
+#define ALIVE 0x5EED
+
+typedef struct {
+    int magic;
+    long value;
+    EBRLink link;
+} Object;
+
+static EpochDomain *domain;
+static _Atomic(Object *) shared;
+static atomic_int writer_done;
+static atomic_long freed;
+
+static void free_object(EBRLink *link) {
+    Object *obj = EBR_ENTRY(link, Object, link);
+    obj->magic = 0;   // a reader still holding it would notice
+    free(obj);
+    atomic_fetch_add(&freed, 1);
+}
+
+/* reads the published object inside a critical section, it must still be alive */
+static void *reader_main(void *arg) {
+    (void)arg;
+    long reads = 0;
+    while (!atomic_load(&writer_done)) {
+        EpochGuard *guard = ebr_enter(domain);
+        assert(guard != NULL);
+        Object *obj = atomic_load(&shared);
+        for (int i = 0; i < 16; ++i) {
+            assert(obj->magic == ALIVE);
+        }
+        ebr_exit(guard);
+        if (++reads % 64 == 0) {
+            sched_yield();
+        }
+    }
+    return (NULL);
+}
+
+int main(void) {
+    domain = ebr_create();
+    assert(domain != NULL);
+    Object *first = malloc(sizeof(Object));
+    assert(first != NULL);
+    first->magic = ALIVE;
+    first->value = 0;
+    atomic_store(&shared, first);
+
+    pthread_t readers[READERS];
+    for (int i = 0; i < READERS; ++i) {
+        assert(pthread_create(&readers[i], NULL, reader_main, NULL) == 0);
+    }
+
+    /* writer: publish a new object, retire the old one */
+    for (long i = 1; i <= SWAPS; ++i) {
+        Object *obj = malloc(sizeof(Object));
+        assert(obj != NULL);
+        obj->magic = ALIVE;
+        obj->value = i;
+        EpochGuard *guard = ebr_enter(domain);
+        Object *old = atomic_exchange(&shared, obj);
+        assert(ebr_retire(guard, &old->link, free_object) == EBR_OK);
+        ebr_exit(guard);
+    }
+    atomic_store(&writer_done, 1);
+
+    for (int i = 0; i < READERS; ++i) {
+        pthread_join(readers[i], NULL);
+    }
+
+    /* most objects were reclaimed on the fly, destroy frees the rest */
+    long reclaimed = atomic_load(&freed);
+    assert(reclaimed > SWAPS / 2);
+    ebr_destroy(domain);
+    assert(atomic_load(&freed) == SWAPS);
+    free(atomic_load(&shared));
+
+    printf("✓ epoch_reclaim stress test passed: %d readers, %d retirements, %ld reclaimed on the fly\n",
+        READERS, SWAPS, reclaimed);
+    return EXIT_SUCCESS;
+}
@@ -35,7 +35,26 @@ int main(void) {
     assert(heap_is_empty(h));
     heap_destroy(h);
 
-    puts("✓ stress test passed: inserted & removed 1 million random elements");
+    // build the same amount at once with heapify, then drain it
+    int *vals = malloc(N * sizeof(int));
+    assert(vals != NULL);
+    for (size_t i = 0; i < N; ++i) {
+        vals[i] = rand();
+    }
+    h = heap_create_from(vals, N, sizeof(int), int_min_cmp);
+    free(vals);
+    assert(h != NULL && heap_size(h) == N);
+    last = -1;
+    for (size_t i = 0; i < N; ++i) {
+        int *top = heap_peek(h);
+        assert(*top >= last);
+        last = *top;
+        assert(heap_remove_top(h) == HEAP_OK);
+    }
+    assert(heap_is_empty(h));
+    heap_destroy(h);
+
+    puts("✓ stress test passed: inserted & removed 1 million random elements, heapified & removed 1 million more");
 
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,114 @@
+#include "heap.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+/*
+** push / pop benchmark of the heap arities on 4, 8 and 32-byte elements
+** every run keeps the heap at N elements while doing OPS pop + push pairs
+** (the scheduler pattern), then drains it checking the order
+*/
+
+#define N (1 << 17)      // elements kept in the heap
+#define OPS 500000       // pop + push pairs per run
+#define MAX_ELEM 32
+
+typedef struct {
+    uint64_t key;
+    unsigned char payload[24];
+} Record;   // 32 bytes
+
+static int cmp_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return ((x > y) - (x < y));
+}
+
+static int cmp_u64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return ((x > y) - (x < y));
+}
+
+static uint64_t rng_state = 88172645463325252ull;
+
+static uint64_t next_key(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (rng_state >> 33);   // fits in 32 bits
+}
+
+/* writes a random key in the first bytes of `elem` (the rest is payload) */
+static void make_elem(unsigned char *elem, size_t elem_size) {
+    uint64_t key = next_key();
+    memset(elem, 0xAB, elem_size);
+    if (elem_size == 4) {
+        uint32_t k = (uint32_t)key;
+        memcpy(elem, &k, 4);
+    } else {
+        memcpy(elem, &key, 8);
+    }
+}
+
+static uint64_t key_of(const void *elem, size_t elem_size) {
+    if (elem_size == 4) {
+        return (*(const uint32_t *)elem);
+    }
+    return (*(const uint64_t *)elem);
+}
+
+static double elapsed_ms(struct timespec start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return ((double)(end.tv_sec - start.tv_sec) * 1e3 + (double)(end.tv_nsec - start.tv_nsec) / 1e6);
+}
+
+static double run(size_t elem_size, heap_cmp_fn cmp, size_t arity) {
+    unsigned char elem[MAX_ELEM];
+    Heap *h = heap_create_arity(elem_size, cmp, arity);
+    assert(h != NULL);
+
+    for (size_t i = 0; i < N; ++i) {
+        make_elem(elem, elem_size);
+        assert(heap_insert(h, elem) == HEAP_OK);
+    }
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < OPS; ++i) {
+        assert(heap_remove_top(h) == HEAP_OK);
+        make_elem(elem, elem_size);
+        assert(heap_insert(h, elem) == HEAP_OK);
+    }
+    double ms = elapsed_ms(start);
+
+    uint64_t last = 0;
+    while (!heap_is_empty(h)) {
+        uint64_t key = key_of(heap_peek(h), elem_size);
+        assert(key >= last);
+        last = key;
+        assert(heap_remove_top(h) == HEAP_OK);
+    }
+    heap_destroy(h);
+    return (ms);
+}
+
+int main(void) {
+    assert(sizeof(Record) == 32);
+    size_t sizes[] = { sizeof(uint32_t), sizeof(uint64_t), sizeof(Record) };
+    heap_cmp_fn cmps[] = { cmp_u32, cmp_u64, cmp_u64 };
+    size_t arities[] = { 2, 4, 8 };
+
+    for (size_t s = 0; s < 3; ++s) {
+        printf("  %2zu-byte elements:", sizes[s]);
+        for (size_t a = 0; a < 3; ++a) {
+            printf("  d=%zu %7.1f ms", arities[a], run(sizes[s], cmps[s], arities[a]));
+        }
+        printf("\n");
+    }
+
+    printf("✓ heap_arity stress test passed: %d elements, %d pop/push pairs per run\n", N, OPS);
+    return EXIT_SUCCESS;
+}
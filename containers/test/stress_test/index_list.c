@@ -0,0 +1,90 @@
+#include "index_list.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define N 1000000    // elements appended, walked and sorted
+#define REF_CAP 4096 // size bound of the random edit phase
+#define OPS 200000   // random edits
+
+static int cmp_int(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return ((x > y) - (x < y));
+}
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    IndexList *list = ixl_create(sizeof(int));
+    assert(list != NULL);
+
+    for (int i = 0; i < N; ++i) {
+        assert(ixl_push_back(list, &i) == IXL_OK);
+    }
+
+    /* sequential index loop: linear thanks to the finger */
+    for (size_t i = 0; i < N; ++i) {
+        assert(*(int *)ixl_get(list, i) == (int)i);
+    }
+
+    /* filter out odd values with a cursor, the freed slots get reused below */
+    IXLCursor cur = ixl_cursor_begin(list);
+    while (!ixl_cursor_is_end(&cur)) {
+        if (*(int *)ixl_cursor_get(&cur) % 2 != 0) {
+            assert(ixl_cursor_erase(&cur) == IXL_OK);
+        } else {
+            assert(ixl_cursor_next(&cur) == IXL_OK);
+        }
+    }
+    assert(ixl_size(list) == N / 2);
+
+    /* refill with random values and sort */
+    for (int i = 0; i < N / 2; ++i) {
+        int val = rand();
+        assert(ixl_push_front(list, &val) == IXL_OK);
+    }
+    assert(ixl_sort(list, cmp_int) == IXL_OK);
+    assert(ixl_size(list) == N);
+    int prev = -1;
+    for (cur = ixl_cursor_begin(list); !ixl_cursor_is_end(&cur); ixl_cursor_next(&cur)) {
+        int value = *(int *)ixl_cursor_get(&cur);
+        assert(value >= prev);
+        prev = value;
+    }
+
+    /* random edits mixed with index access, checked against a plain array */
+    ixl_clear(list);
+    int ref[REF_CAP];
+    size_t ref_size = 0;
+    for (int i = 0; i < OPS; ++i) {
+        int op = rand() % 4;
+        if (op == 0 && ref_size < REF_CAP) {
+            size_t index = (size_t)rand() % (ref_size + 1);
+            assert(ixl_insert_at(list, index, &i) == IXL_OK);
+            for (size_t j = ref_size; j > index; --j) {
+                ref[j] = ref[j - 1];
+            }
+            ref[index] = i;
+            ref_size++;
+        } else if (op == 1 && ref_size > 0) {
+            size_t index = (size_t)rand() % ref_size;
+            assert(ixl_remove_at(list, index) == IXL_OK);
+            for (size_t j = index; j + 1 < ref_size; ++j) {
+                ref[j] = ref[j + 1];
+            }
+            ref_size--;
+        } else if (ref_size > 0) {
+            size_t index = (size_t)rand() % ref_size;
+            assert(*(int *)ixl_get(list, index) == ref[index]);
+        }
+    }
+    assert(ixl_size(list) == ref_size);
+    for (size_t i = 0; i < ref_size; ++i) {
+        assert(*(int *)ixl_get(list, i) == ref[i]);
+    }
+
+    ixl_destroy(list);
+    printf("✓ index_list stress test passed: %d elements sorted, %d random edits, final size = %zu\n", N, OPS, ref_size);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,73 @@
+#include "indexed_pq.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define N 200000        // handles in play
+#define OPS 1000000     // random updates / removes / pushes
+
+static int int_min_cmp(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return ((x > y) - (x < y));
+}
+
+/* value[h] mirrors the queue: the element of handle h, or -1 once released */
+static int value[N];
+
+int main(void) {
+    srand((unsigned int)time(NULL));
+
+    IndexedPQ *ipq = ipq_create(sizeof(int), int_min_cmp);
+    assert(ipq != NULL);
+
+    for (size_t i = 0; i < N; ++i) {
+        int v = rand();
+        size_t h = ipq_push(ipq, &v);
+        assert(h == i);
+        value[h] = v;
+    }
+
+    size_t live = N;
+    for (size_t i = 0; i < OPS; ++i) {
+        size_t h = (size_t)rand() % N;
+        int op = rand() % 4;
+
+        if (value[h] < 0) {
+            int v = rand();
+            size_t got = ipq_push(ipq, &v);
+            assert(got < N && value[got] < 0);
+            value[got] = v;
+            ++live;
+        } else if (op == 0) {
+            assert(ipq_remove(ipq, h) == IPQ_OK);
+            value[h] = -1;
+            --live;
+        } else {
+            int v = rand();
+            assert(ipq_update(ipq, h, &v) == IPQ_OK);
+            value[h] = v;
+        }
+
+        assert(ipq_size(ipq) == live);
+    }
+
+    /* every element comes out once, in order, with the value of its handle */
+    int last = -1;
+    while (!ipq_is_empty(ipq)) {
+        size_t h = ipq_top_handle(ipq);
+        int top = *(int *)ipq_top(ipq);
+        assert(top == value[h] && top >= last);
+        last = top;
+        value[h] = -1;
+        assert(ipq_pop(ipq) == IPQ_OK);
+        --live;
+    }
+
+    assert(live == 0);
+    ipq_destroy(ipq);
+
+    printf("✓ indexed_pq stress test passed: %d handles, %d random updates / removes / pushes\n", N, OPS);
+    return (EXIT_SUCCESS);
+}
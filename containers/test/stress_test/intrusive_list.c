@@ -0,0 +1,106 @@
+#include "intrusive_list.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define N 100000         // objects, allocated once
+#define CAPACITY 10000   // LRU capacity
+#define OPS 2000000      // random accesses
+
+/* an object living in two lists at once: the LRU and one of two run queues */
+typedef struct Entry {
+    size_t key;
+    int queue;           // run queue index, or -1
+    IListLink lru_link;
+    IListLink run_link;
+} Entry;
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    Entry *entries = malloc(sizeof(Entry) * N);
+    assert(entries != NULL);
+
+    for (size_t i = 0; i < N; ++i) {
+        entries[i].key = i;
+        entries[i].queue = -1;
+        ilist_link_init(&entries[i].lru_link);
+        ilist_link_init(&entries[i].run_link);
+    }
+
+    IList lru, runq[2];
+    ilist_init(&lru);
+    ilist_init(&runq[0]);
+    ilist_init(&runq[1]);
+
+    /* LRU simulation: every access is pure relinking, no allocation */
+    size_t hits = 0;
+    for (size_t op = 0; op < OPS; ++op) {
+        Entry *e = &entries[(size_t)rand() % N];
+
+        if (ilist_is_linked(&e->lru_link)) {
+            assert(ilist_move_to_front(&lru, &lru, &e->lru_link) == ILIST_OK);
+            hits++;
+        } else {
+            if (ilist_size(&lru) == CAPACITY) {
+                IListLink *victim = ilist_pop_back(&lru);
+                assert(victim != NULL && !ilist_is_linked(victim));
+            }
+            assert(ilist_push_front(&lru, &e->lru_link) == ILIST_OK);
+        }
+
+        assert(ILIST_ENTRY(ilist_front(&lru), Entry, lru_link) == e);
+    }
+    assert(ilist_size(&lru) == CAPACITY);
+
+    size_t count = 0;
+    for (IListLink *it = ilist_front(&lru); it != NULL; it = ilist_next(&lru, it)) {
+        Entry *e = ILIST_ENTRY(it, Entry, lru_link);
+        assert(e >= entries && e < entries + N && e->key == (size_t)(e - entries));
+        count++;
+    }
+    assert(count == CAPACITY);
+
+    /* run queues: migrate objects between the two lists */
+    for (size_t i = 0; i < N; ++i) {
+        entries[i].queue = 0;
+        assert(ilist_push_back(&runq[0], &entries[i].run_link) == ILIST_OK);
+    }
+
+    for (size_t op = 0; op < OPS; ++op) {
+        Entry *e = &entries[(size_t)rand() % N];
+        int to = rand() % 2;
+
+        if (rand() % 2) {
+            assert(ilist_move_to_back(&runq[to], &runq[e->queue], &e->run_link) == ILIST_OK);
+        } else {
+            assert(ilist_move_to_front(&runq[to], &runq[e->queue], &e->run_link) == ILIST_OK);
+        }
+        e->queue = to;
+    }
+    assert(ilist_size(&runq[0]) + ilist_size(&runq[1]) == N);
+
+    for (int q = 0; q < 2; ++q) {
+        count = 0;
+        for (IListLink *it = ilist_back(&runq[q]); it != NULL; it = ilist_prev(&runq[q], it)) {
+            assert(ILIST_ENTRY(it, Entry, run_link)->queue == q);
+            count++;
+        }
+        assert(count == ilist_size(&runq[q]));
+    }
+
+    /* the LRU membership was never disturbed by the run queue traffic */
+    assert(ilist_size(&lru) == CAPACITY);
+
+    ilist_clear(&lru);
+    ilist_clear(&runq[0]);
+    ilist_clear(&runq[1]);
+    for (size_t i = 0; i < N; ++i) {
+        assert(!ilist_is_linked(&entries[i].lru_link) && !ilist_is_linked(&entries[i].run_link));
+    }
+
+    free(entries);
+    printf("✓ intrusive_list stress test passed: %d LRU accesses (%zu hits), %d run queue moves\n", OPS, hits, OPS);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+#include "lockfree_list.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#define THREADS 4
+#define PER_THREAD 200000   // values pushed by each thread
+#define KEYS 500            // ordered keys inserted / erased by each thread
+#define ROUNDS 20
+
+static LockFreeList *list;
+static _Atomic unsigned char *seen;   // seen[v] is set once value v was popped
+
+static void take(long value) {
+    /* every value must come out exactly once */
+    assert(atomic_exchange(&seen[value], 1) == 0);
+}
+
+/* pushes its own values, popping every other step */
+static void *stack_main(void *arg) {
+    long t = (long)arg;
+    for (long i = 0; i < PER_THREAD; ++i) {
+        long v = t * PER_THREAD + i;
+        assert(lfl_push_front(list, &v) == LFL_OK);
+        if (i % 2 == 1) {
+            long out;
+            if (lfl_pop_front(list, &out) == LFL_OK) {
+                take(out);
+            }
+        }
+    }
+    return (NULL);
+}
+
+static int cmp_long(const void *a, const void *b) {
+    long x = *(const long *)a, y = *(const long *)b;
+    return ((x > y) - (x < y));
+}
+
+/* inserts keys t, t + THREADS, ... then erases them back, several times over */
+static void *ordered_main(void *arg) {
+    long t = (long)arg;
+    for (int round = 0; round < ROUNDS; ++round) {
+        for (long i = 0; i < KEYS; ++i) {
+            long v = i * THREADS + t;
+            assert(lfl_insert(list, &v) == LFL_OK);
+        }
+        for (long i = 0; i < KEYS; ++i) {
+            long v = i * THREADS + t, out = -1;
+            assert(lfl_find(list, &v, &out) == LFL_OK && out == v);
+            /* the last round keeps the even keys */
+            if (round + 1 < ROUNDS || v % 2 != 0) {
+                assert(lfl_erase(list, &v) == LFL_OK);
+            }
+        }
+    }
+    return (NULL);
+}
+
+int main(void) {
+    pthread_t threads[THREADS];
+
+    /* push / pop from every thread */
+    list = lfl_create(sizeof(long), NULL);
+    seen = calloc(THREADS * PER_THREAD, 1);
+    assert(list != NULL && seen != NULL);
+    for (long t = 0; t < THREADS; ++t) {
+        assert(pthread_create(&threads[t], NULL, stack_main, (void *)t) == 0);
+    }
+    for (int t = 0; t < THREADS; ++t) {
+        pthread_join(threads[t], NULL);
+    }
+    long out;
+    while (lfl_pop_front(list, &out) == LFL_OK) {
+        take(out);
+    }
+    for (long v = 0; v < THREADS * PER_THREAD; ++v) {
+        assert(seen[v] == 1);
+    }
+    assert(lfl_is_empty(list));
+    lfl_destroy(list);
+    free((void *)seen);
+
+    /* ordered insert / find / erase from every thread */
+    list = lfl_create(sizeof(long), cmp_long);
+    assert(list != NULL);
+    for (long t = 0; t < THREADS; ++t) {
+        assert(pthread_create(&threads[t], NULL, ordered_main, (void *)t) == 0);
+    }
+    for (int t = 0; t < THREADS; ++t) {
+        pthread_join(threads[t], NULL);
+    }
+    assert(lfl_size(list) == THREADS * KEYS / 2);
+    for (long expected = 0; lfl_pop_front(list, &out) == LFL_OK; expected += 2) {
+        assert(out == expected);
+    }
+    assert(lfl_is_empty(list));
+    lfl_destroy(list);
+
+    printf("✓ lockfree_list stress test passed: %d threads, %d push/pop each, %d x %d ordered inserts each\n",
+        THREADS, PER_THREAD, ROUNDS, KEYS);
+    return EXIT_SUCCESS;
+}
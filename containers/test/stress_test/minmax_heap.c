@@ -0,0 +1,81 @@
+#include "minmax_heap.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define N 1000000     // elements drained from both ends
+#define MIXED 200000  // random operations checked against counters
+#define RANGE 256     // value range of the mixed phase
+
+static int int_cmp(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return ((x > y) - (x < y));
+}
+
+static int vals[N];
+
+int main(void) {
+    srand((unsigned int)time(NULL));
+
+    MinMaxHeap *mmh = mmh_create(sizeof(int), int_cmp);
+    assert(mmh != NULL);
+
+    /* random ends, checked against the sorted input */
+    for (size_t i = 0; i < N; ++i) {
+        vals[i] = rand();
+        assert(mmh_insert(mmh, &vals[i]) == MMH_OK);
+    }
+    qsort(vals, N, sizeof(int), int_cmp);
+
+    size_t lo = 0;
+    size_t hi = N;
+    while (lo < hi) {
+        if (rand() % 2) {
+            assert(*(int *)mmh_peek_min(mmh) == vals[lo++]);
+            assert(mmh_pop_min(mmh) == MMH_OK);
+        } else {
+            assert(*(int *)mmh_peek_max(mmh) == vals[--hi]);
+            assert(mmh_pop_max(mmh) == MMH_OK);
+        }
+    }
+    assert(mmh_is_empty(mmh));
+
+    /* inserts and pops mixed, with a counter per value as reference */
+    static size_t count[RANGE];
+    size_t size = 0;
+    for (size_t i = 0; i < MIXED; ++i) {
+        int op = rand() % 3;
+
+        if (op == 0 || size == 0) {
+            int v = rand() % RANGE;
+            assert(mmh_insert(mmh, &v) == MMH_OK);
+            count[v]++;
+            size++;
+            continue ;
+        }
+
+        int min = 0;
+        int max = RANGE - 1;
+        while (count[min] == 0) ++min;
+        while (count[max] == 0) --max;
+        assert(*(int *)mmh_peek_min(mmh) == min);
+        assert(*(int *)mmh_peek_max(mmh) == max);
+
+        if (op == 1) {
+            assert(mmh_pop_min(mmh) == MMH_OK);
+            count[min]--;
+        } else {
+            assert(mmh_pop_max(mmh) == MMH_OK);
+            count[max]--;
+        }
+        size--;
+        assert(mmh_size(mmh) == size);
+    }
+
+    mmh_destroy(mmh);
+
+    printf("✓ minmax_heap stress test passed: %d elements drained from random ends, %d mixed operations\n", N, MIXED);
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,142 @@
+#include "multiqueue.h"
+#include "priority_queue.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+
+#define THREADS 4
+#define QUEUES_PER_THREAD 4
+#define PER_THREAD 200000   // values pushed by each thread in the correctness phase
+#define PREFILL 100000      // elements in the queue before the benchmark
+#define OPS 500000          // pop / push pairs per thread in the benchmark
+
+static int int_cmp(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return ((x > y) - (x < y));
+}
+
+static double elapsed_ms(struct timespec start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return ((end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6);
+}
+
+/* correctness: every value pushed comes out exactly once */
+
+static MultiQueue *mq;
+static _Atomic unsigned char *seen;
+
+static void take(int value) {
+    assert(value >= 0 && value < THREADS * PER_THREAD);
+    assert(atomic_exchange(&seen[value], 1) == 0);
+}
+
+static void *mixed_main(void *arg) {
+    int t = (int)(long)arg;
+    for (int i = 0; i < PER_THREAD; ++i) {
+        int v = t * PER_THREAD + i;
+        assert(mq_push(mq, &v) == MQ_OK);
+        if (i % 2 == 1) {
+            int out;
+            if (mq_pop(mq, &out) == MQ_OK) {
+                take(out);
+            }
+        }
+    }
+    return (NULL);
+}
+
+/* benchmark: pop then push a slightly larger key, like a parallel Dijkstra worker */
+
+static PriorityQueue *locked_pq;
+static pthread_mutex_t locked_pq_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void *mq_bench_main(void *arg) {
+    unsigned int seed = (unsigned int)(long)arg + 1;
+    for (int i = 0; i < OPS; ++i) {
+        int v;
+        if (mq_pop(mq, &v) != MQ_OK) {
+            v = 0;
+        }
+        v += rand_r(&seed) % 1000;
+        assert(mq_push(mq, &v) == MQ_OK);
+    }
+    return (NULL);
+}
+
+static void *pq_bench_main(void *arg) {
+    unsigned int seed = (unsigned int)(long)arg + 1;
+    for (int i = 0; i < OPS; ++i) {
+        int v = 0;
+        pthread_mutex_lock(&locked_pq_lock);
+        if (!pq_is_empty(locked_pq)) {
+            v = *(int *)pq_top(locked_pq);
+            pq_pop(locked_pq);
+        }
+        pthread_mutex_unlock(&locked_pq_lock);
+        v += rand_r(&seed) % 1000;
+        pthread_mutex_lock(&locked_pq_lock);
+        assert(pq_push(locked_pq, &v) == PQ_OK);
+        pthread_mutex_unlock(&locked_pq_lock);
+    }
+    return (NULL);
+}
+
+static double run_threads(void *(*fn)(void *)) {
+    pthread_t threads[THREADS];
+    struct timespec start;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (long t = 0; t < THREADS; ++t) {
+        assert(pthread_create(&threads[t], NULL, fn, (void *)t) == 0);
+    }
+    for (int t = 0; t < THREADS; ++t) {
+        pthread_join(threads[t], NULL);
+    }
+
+    return (elapsed_ms(start));
+}
+
+int main(void) {
+    srand((unsigned int)time(NULL));
+
+    mq = mq_create(sizeof(int), int_cmp, THREADS * QUEUES_PER_THREAD);
+    seen = calloc(THREADS * PER_THREAD, 1);
+    assert(mq != NULL && seen != NULL);
+
+    run_threads(mixed_main);
+
+    int out;
+    while (mq_pop(mq, &out) == MQ_OK) {
+        take(out);
+    }
+    for (int v = 0; v < THREADS * PER_THREAD; ++v) {
+        assert(seen[v] == 1);
+    }
+    assert(mq_is_empty(mq));
+
+    /* same prefilled workload on both queues */
+    locked_pq = pq_create(sizeof(int), int_cmp);
+    assert(locked_pq != NULL);
+    for (int i = 0; i < PREFILL; ++i) {
+        int v = rand() % 1000000;
+        assert(mq_push(mq, &v) == MQ_OK);
+        assert(pq_push(locked_pq, &v) == PQ_OK);
+    }
+
+    double mq_ms = run_threads(mq_bench_main);
+    double pq_ms = run_threads(pq_bench_main);
+    assert(mq_size(mq) == PREFILL && pq_size(locked_pq) == PREFILL);
+
+    mq_destroy(mq);
+    pq_destroy(locked_pq);
+    free(seen);
+
+    printf("✓ multiqueue stress test passed: %d values through %d threads, %d pop/push pairs per thread: multiqueue %.1f ms, mutex + priority_queue %.1f ms\n",
+           THREADS * PER_THREAD, THREADS, OPS, mq_ms, pq_ms);
+    return (EXIT_SUCCESS);
+}
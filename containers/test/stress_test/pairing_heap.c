@@ -0,0 +1,75 @@
+#include "pairing_heap.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <limits.h>
+
+#define N 1000000       // elements inserted
+#define HEAPS 64        // heaps melded back together
+#define DECREASES 200000
+
+static int int_min_cmp(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return ((x > y) - (x < y));
+}
+
+static PHNode *nodes[N];
+
+static double elapsed_ms(struct timespec start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return ((end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6);
+}
+
+int main(void) {
+    srand((unsigned int)time(NULL));
+
+    PairingHeap *heaps[HEAPS];
+    for (size_t h = 0; h < HEAPS; ++h) {
+        heaps[h] = ph_create(sizeof(int), int_min_cmp);
+        assert(heaps[h] != NULL);
+    }
+
+    for (size_t i = 0; i < N; ++i) {
+        int val = rand() % (RAND_MAX / 2) + RAND_MAX / 4;
+        nodes[i] = ph_insert(heaps[i % HEAPS], &val);
+        assert(nodes[i] != NULL);
+    }
+
+    /* meld pairwise, like a tournament: every meld is O(1) */
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t step = 1; step < HEAPS; step *= 2) {
+        for (size_t h = 0; h + step < HEAPS; h += 2 * step) {
+            assert(ph_meld(heaps[h], heaps[h + step]) == PH_OK);
+        }
+    }
+    double meld_ms = elapsed_ms(start);
+    assert(ph_size(heaps[0]) == N);
+
+    /* half the population gets pulled from deep inside the tree */
+    for (size_t i = 0; i < DECREASES; ++i) {
+        PHNode *node = nodes[(size_t)rand() % N];
+        int val = *(int *)ph_value(node) - rand() % (RAND_MAX / 4);
+        assert(ph_decrease_key(heaps[0], node, &val) == PH_OK);
+    }
+
+    int last = INT_MIN;
+    for (size_t i = 0; i < N; ++i) {
+        int top = *(int *)ph_peek(heaps[0]);
+        assert(top >= last);
+        last = top;
+        assert(ph_remove_top(heaps[0]) == PH_OK);
+    }
+    assert(ph_is_empty(heaps[0]));
+
+    for (size_t h = 0; h < HEAPS; ++h) {
+        ph_destroy(heaps[h]);
+    }
+
+    printf("✓ pairing_heap stress test passed: %d elements melded from %d heaps in %.3f ms, %d decrease-keys\n",
+        N, HEAPS, meld_ms, DECREASES);
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,48 @@
+#include "pool_allocator.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define N 1000000    // live blocks at peak
+#define ROUNDS 5     // fill / churn / clear cycles
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    PoolAllocator *pool = pool_create(sizeof(size_t) * 3);
+    size_t **blocks = malloc(sizeof(size_t *) * N);
+    assert(pool != NULL && blocks != NULL);
+
+    for (int round = 0; round < ROUNDS; ++round) {
+        for (size_t i = 0; i < N; ++i) {
+            blocks[i] = pool_alloc(pool);
+            assert(blocks[i] != NULL);
+            blocks[i][0] = i;
+            blocks[i][2] = ~i;
+        }
+
+        /* churn: free and reallocate random blocks */
+        for (size_t i = 0; i < N; ++i) {
+            size_t index = (size_t)rand() % N;
+            assert(blocks[index][0] == index && blocks[index][2] == ~index);
+            pool_free(pool, blocks[index]);
+            blocks[index] = pool_alloc(pool);
+            assert(blocks[index] != NULL);
+            blocks[index][0] = index;
+            blocks[index][2] = ~index;
+        }
+
+        for (size_t i = 0; i < N; ++i) {
+            assert(blocks[i][0] == i && blocks[i][2] == ~i);
+        }
+
+        pool_clear(pool);
+    }
+
+    free(blocks);
+    pool_destroy(pool);
+
+    printf("✓ pool_allocator stress test passed: %d rounds of %d blocks\n", ROUNDS, N);
+    return EXIT_SUCCESS;
+}
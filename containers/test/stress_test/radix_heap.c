@@ -0,0 +1,88 @@
+#include "radix_heap.h"
+#include "heap.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define N 100000      // pending events
+#define OPS 2000000   // pop one event, schedule one later
+
+/* event simulation: each popped event schedules a new one a random delay after it */
+
+typedef struct {
+    uint64_t time;
+    uint32_t id;
+} Event;
+
+static int event_cmp(const void *a, const void *b) {
+    uint64_t x = ((const Event *)a)->time;
+    uint64_t y = ((const Event *)b)->time;
+    return ((x > y) - (x < y));
+}
+
+static double elapsed_ms(struct timespec start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return ((end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6);
+}
+
+static uint64_t delays[OPS];
+
+int main(void) {
+    srand((unsigned int)time(NULL));
+
+    for (size_t i = 0; i < OPS; ++i) {
+        delays[i] = (uint64_t)rand() % 100000;
+    }
+
+    /* radix heap: the id is the payload */
+    RadixHeap *rh = rh_create(sizeof(uint32_t));
+    assert(rh != NULL);
+
+    for (uint32_t i = 0; i < N; ++i) {
+        assert(rh_push(rh, delays[i], &i) == RH_OK);
+    }
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    uint64_t last = 0;
+    for (size_t i = 0; i < OPS; ++i) {
+        uint64_t now;
+        uint32_t id;
+        assert(rh_pop(rh, &now, &id) == RH_OK);
+        assert(now >= last);
+        last = now;
+        assert(rh_push(rh, now + delays[(i + id) % OPS], &id) == RH_OK);
+    }
+    double rh_ms = elapsed_ms(start);
+
+    /* same workload on the comparator-driven heap */
+    Heap *h = heap_create(sizeof(Event), event_cmp);
+    assert(h != NULL);
+
+    for (uint32_t i = 0; i < N; ++i) {
+        Event e = { delays[i], i };
+        assert(heap_insert(h, &e) == HEAP_OK);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (size_t i = 0; i < OPS; ++i) {
+        Event e = *(Event *)heap_peek(h);
+        assert(heap_remove_top(h) == HEAP_OK);
+        e.time += delays[(i + e.id) % OPS];
+        assert(heap_insert(h, &e) == HEAP_OK);
+    }
+    double heap_ms = elapsed_ms(start);
+
+    assert(rh_size(rh) == N && heap_size(h) == N);
+
+    rh_destroy(rh);
+    heap_destroy(h);
+
+    printf("✓ radix_heap stress test passed: %d pending events, %d pop/push pairs: radix heap %.1f ms, binary heap %.1f ms\n",
+        N, OPS, rh_ms, heap_ms);
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,100 @@
+#include "shm_queue.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/wait.h>
+
+#define N 1000000       // elements produced
+#define CONSUMERS 3     // consumer processes
+#define STOP (-1L)      // sentinel telling a consumer to exit
+
+int main(void) {
+    char data_name[64], result_name[64];
+    snprintf(data_name, sizeof(data_name), "/adrc_shmq_stress_%d", (int)getpid());
+    snprintf(result_name, sizeof(result_name), "/adrc_shmq_result_%d", (int)getpid());
+
+    ShmQueue *data = shmq_create(data_name, 1024, sizeof(long));
+    ShmQueue *results = shmq_create(result_name, CONSUMERS, sizeof(long) * 2);
+    assert(data != NULL && results != NULL);
+
+    pid_t pids[CONSUMERS];
+
+    for (int c = 0; c < CONSUMERS; ++c) {
+        pids[c] = fork();
+        assert(pids[c] != -1);
+
+        if (pids[c] == 0) {
+            /* consumer: attach by name, sum everything until the sentinel */
+            ShmQueue *in = shmq_open(data_name);
+            ShmQueue *out = shmq_open(result_name);
+            if (in == NULL || out == NULL) {
+                _exit(EXIT_FAILURE);
+            }
+
+            long acc[2] = { 0, 0 }; // sum, count
+            long val;
+            for (;;) {
+                while (shmq_dequeue(in, &val) == SHMQ_ERR) {
+                    sched_yield();
+                }
+                if (val == STOP) {
+                    break ;
+                }
+                acc[0] += val;
+                acc[1] += 1;
+            }
+
+            while (shmq_enqueue(out, acc) == SHMQ_ERR) {
+                sched_yield();
+            }
+            shmq_close(in);
+            shmq_close(out);
+            _exit(EXIT_SUCCESS);
+        }
+    }
+
+    /* producer */
+    for (long i = 1; i <= N; ++i) {
+        while (shmq_enqueue(data, &i) == SHMQ_ERR) {
+            sched_yield();
+        }
+    }
+
+    for (int c = 0; c < CONSUMERS; ++c) {
+        long stop = STOP;
+        while (shmq_enqueue(data, &stop) == SHMQ_ERR) {
+            sched_yield();
+        }
+    }
+
+    long sum = 0, count = 0;
+    for (int c = 0; c < CONSUMERS; ++c) {
+        long acc[2];
+        while (shmq_dequeue(results, acc) == SHMQ_ERR) {
+            sched_yield();
+        }
+        sum += acc[0];
+        count += acc[1];
+    }
+
+    for (int c = 0; c < CONSUMERS; ++c) {
+        int status;
+        assert(waitpid(pids[c], &status, 0) == pids[c]);
+        assert(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS);
+    }
+
+    /* every element was consumed exactly once */
+    assert(count == N);
+    assert(sum == (long)N * (N + 1) / 2);
+    assert(shmq_is_empty(data));
+
+    shmq_close(data);
+    shmq_close(results);
+    assert(shmq_unlink(data_name) == SHMQ_OK);
+    assert(shmq_unlink(result_name) == SHMQ_OK);
+
+    printf("✓ stress test passed: %d elements across %d consumer processes\n", N, CONSUMERS);
+    return EXIT_SUCCESS;
+}
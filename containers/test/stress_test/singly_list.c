@@ -4,6 +4,11 @@
 #include <stdlib.h>
 #include <time.h>
 
+/* orders by key only (value / 1e6), so stability is observable */
+static int cmp_key(const void *a, const void *b) {
+    return (*(const int *)a / 1000000 - *(const int *)b / 1000000);
+}
+
 int main(void) {
     srand((unsigned)time(NULL));
 
@@ -45,6 +50,121 @@ int main(void) {
         assert(sl_remove_at(list, index) == SL_OK);
     }
 
+    // index-based sequential loop (linear thanks to the finger)
+    int prev_value = -1;
+    for (size_t i = 0; i < sl_size(list); ++i) {
+        int *value = (int *)sl_get(list, i);
+        assert(value != NULL);
+        if (*value == head || *value == mid || *value == tail) {
+            continue ;  // markers inserted above
+        }
+        assert(*value > prev_value);
+        prev_value = *value;
+    }
+
+    // filter out odd values in one linear pass with a cursor
+    size_t before = sl_size(list), removed = 0;
+    SLCursor cur = sl_cursor_begin(list);
+    while (!sl_cursor_is_end(&cur)) {
+        if (*(int *)sl_cursor_get(&cur) % 2 != 0) {
+            assert(sl_cursor_erase(&cur) == SL_OK);
+            removed++;
+        } else {
+            assert(sl_cursor_next(&cur) == SL_OK);
+        }
+    }
+    assert(sl_size(list) == before - removed);
+
+    // random edits mixed with index access, checked against a plain array
+    sl_clear(list);
+    int ref[4096];
+    size_t ref_size = 0;
+    for (size_t i = 0; i < 200000; ++i) {
+        int op = rand() % 4;
+        if (op == 0 && ref_size < 4096) {
+            size_t index = rand() % (ref_size + 1);
+            int val = (int)i;
+            assert(sl_insert_at(list, index, &val) == SL_OK);
+            for (size_t j = ref_size; j > index; --j) {
+                ref[j] = ref[j - 1];
+            }
+            ref[index] = val;
+            ref_size++;
+        } else if (op == 1 && ref_size > 0) {
+            size_t index = rand() % ref_size;
+            assert(sl_remove_at(list, index) == SL_OK);
+            for (size_t j = index; j + 1 < ref_size; ++j) {
+                ref[j] = ref[j + 1];
+            }
+            ref_size--;
+        } else if (ref_size > 0) {
+            size_t index = rand() % ref_size;
+            assert(*(int *)sl_get(list, index) == ref[index]);
+        }
+    }
+    assert(sl_size(list) == ref_size);
+    for (size_t i = 0; i < ref_size; ++i) {
+        assert(*(int *)sl_get(list, i) == ref[i]);
+    }
+
+    // incremental compaction interleaved with random edits
+    int status;
+    int next_value = 1 << 30;
+    do {
+        status = sl_compact_step(list, 64);
+        assert(status != SL_ERR);
+        if (ref_size > 0) {
+            size_t index = rand() % ref_size;
+            assert(sl_remove_at(list, index) == SL_OK);
+            for (size_t j = index; j + 1 < ref_size; ++j) {
+                ref[j] = ref[j + 1];
+            }
+            ref_size--;
+        }
+        size_t index = rand() % (ref_size + 1);
+        assert(sl_insert_at(list, index, &next_value) == SL_OK);
+        for (size_t j = ref_size; j > index; --j) {
+            ref[j] = ref[j - 1];
+        }
+        ref[index] = next_value++;
+        ref_size++;
+    } while (status == SL_PENDING);
+    assert(sl_compact(list) == SL_OK);
+    assert(sl_size(list) == ref_size);
+    for (size_t i = 0; i < ref_size; ++i) {
+        assert(*(int *)sl_get(list, i) == ref[i]);
+    }
+
+    // sort a large random list in place, checking order and stability
+    sl_clear(list);
+    for (size_t i = 0; i < N; ++i) {
+        int val = (rand() % 1000) * 1000000 + (int)i % 1000000;  // key * 1e6 + insertion order
+        assert(sl_push_back(list, &val) == SL_OK);
+    }
+    assert(sl_sort(list, cmp_key) == SL_OK);
+    assert(sl_size(list) == N);
+    int prev_sorted = -1;
+    for (size_t i = 0; i < N; ++i) {
+        int value = *(int *)sl_get(list, i);
+        assert(value / 1000000 >= prev_sorted / 1000000);
+        if (value / 1000000 == prev_sorted / 1000000) {
+            assert(value % 1000000 > prev_sorted % 1000000);  // stable
+        }
+        prev_sorted = value;
+    }
+
+    // round trip through a plain array: one walk out, one block back in
+    int *array = malloc(N * sizeof(int));
+    assert(array != NULL);
+    assert(sl_to_array(list, array, N) == N);
+    SinglyList *copy = sl_from_array(sizeof(int), array, N);
+    assert(copy != NULL && sl_size(copy) == N);
+    for (size_t i = 0; i < N; ++i) {
+        assert(*(int *)sl_get(copy, i) == array[i]);
+    }
+    sl_destroy(copy);
+    free(array);
+
     printf("✅ full stress test passed. final size = %zu\n", sl_size(list));
 
     sl_destroy(list);
@@ -0,0 +1,114 @@
+#include "skip_list.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+
+#define N 1000000       // elements of the single-threaded phase
+#define OPS 200000      // random edits checked against a sorted array
+#define REF_CAP 4096    // size bound of the random edit phase
+#define THREADS 4
+#define PER_THREAD 100000
+
+static SkipList *shared;
+
+static int cmp_long(const void *a, const void *b) {
+    long x = *(const long *)a, y = *(const long *)b;
+    return ((x > y) - (x < y));
+}
+
+/* thread t inserts t, t + THREADS, t + 2 * THREADS, ... in a scrambled order */
+static void *inserter_main(void *arg) {
+    long t = (long)arg;
+    for (long i = 0; i < PER_THREAD; ++i) {
+        long v = (i * 7919) % PER_THREAD * THREADS + t;
+        assert(skl_insert(shared, &v) == SKL_OK);
+        assert(skl_find(shared, &v) != NULL);
+    }
+    return (NULL);
+}
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    /* single-threaded: random inserts, then a sorted walk and select checks */
+    SkipList *list = skl_create(sizeof(long), cmp_long);
+    assert(list != NULL);
+    for (long i = 0; i < N; ++i) {
+        long v = rand() % (N / 4);
+        assert(skl_insert(list, &v) == SKL_OK);
+    }
+    assert(skl_size(list) == N);
+    long prev = -1;
+    size_t index = 0;
+    for (SKLCursor cur = skl_cursor_begin(list); !skl_cursor_is_end(&cur); skl_cursor_next(&cur)) {
+        long v = *(long *)skl_cursor_get(&cur);
+        assert(v >= prev);
+        if (index % 1000 == 0) {
+            assert(skl_select(list, index) == skl_cursor_get(&cur));
+        }
+        prev = v;
+        index++;
+    }
+
+    /* random edits checked against a sorted plain array */
+    skl_clear(list);
+    long ref[REF_CAP];
+    size_t ref_size = 0;
+    for (int i = 0; i < OPS; ++i) {
+        long v = rand() % 1000;
+        size_t pos = 0;
+        while (pos < ref_size && ref[pos] < v) {
+            pos++;
+        }
+        int op = rand() % 3;
+        if (op == 0 && ref_size < REF_CAP) {
+            assert(skl_insert(list, &v) == SKL_OK);
+            for (size_t j = ref_size; j > pos; --j) {
+                ref[j] = ref[j - 1];
+            }
+            ref[pos] = v;
+            ref_size++;
+        } else if (op == 1) {
+            int found = pos < ref_size && ref[pos] == v;
+            assert(skl_erase(list, &v) == (found ? SKL_OK : SKL_ERR));
+            if (found) {
+                for (size_t j = pos; j + 1 < ref_size; ++j) {
+                    ref[j] = ref[j + 1];
+                }
+                ref_size--;
+            }
+        } else {
+            assert(skl_rank(list, &v) == pos);
+            if (ref_size > 0) {
+                size_t k = (size_t)rand() % ref_size;
+                assert(*(long *)skl_select(list, k) == ref[k]);
+            }
+        }
+    }
+    assert(skl_size(list) == ref_size);
+    skl_destroy(list);
+
+    /* concurrent: disjoint values inserted from several threads */
+    shared = skl_create_concurrent(sizeof(long), cmp_long);
+    assert(shared != NULL);
+    pthread_t threads[THREADS];
+    for (long t = 0; t < THREADS; ++t) {
+        assert(pthread_create(&threads[t], NULL, inserter_main, (void *)t) == 0);
+    }
+    for (int t = 0; t < THREADS; ++t) {
+        pthread_join(threads[t], NULL);
+    }
+    assert(skl_size(shared) == THREADS * PER_THREAD);
+    long expected = 0;
+    for (SKLCursor cur = skl_cursor_begin(shared); !skl_cursor_is_end(&cur); skl_cursor_next(&cur)) {
+        assert(*(long *)skl_cursor_get(&cur) == expected++);
+    }
+    assert(expected == THREADS * PER_THREAD);
+    skl_destroy(shared);
+
+    printf("✓ skip_list stress test passed: %d elements sorted, %d random edits, %d x %d concurrent inserts\n",
+        N, OPS, THREADS, PER_THREAD);
+    return EXIT_SUCCESS;
+}
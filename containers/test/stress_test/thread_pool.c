@@ -0,0 +1,86 @@
+#include "thread_pool.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define N 2000000      // ints to sort
+#define CUTOFF 4096    // below this, sort sequentially
+#define WORKERS 4
+
+typedef struct SortArgs {
+    ThreadPool *pool;
+    int *arr;
+    int *tmp;
+    size_t len;
+} SortArgs;
+
+static void merge(int *arr, int *tmp, size_t mid, size_t len) {
+    size_t i = 0, j = mid, k = 0;
+
+    while (i < mid && j < len) {
+        tmp[k++] = (arr[i] <= arr[j]) ? arr[i++] : arr[j++];
+    }
+    while (i < mid) {
+        tmp[k++] = arr[i++];
+    }
+    while (j < len) {
+        tmp[k++] = arr[j++];
+    }
+    memcpy(arr, tmp, len * sizeof(int));
+}
+
+/* fork-join merge sort: left half is spawned, right half runs inline */
+static void sort_task(void *arg) {
+    SortArgs *a = arg;
+
+    if (a->len < 2) {
+        return ;
+    }
+
+    size_t mid = a->len / 2;
+    SortArgs left = { a->pool, a->arr, a->tmp, mid };
+    SortArgs right = { a->pool, a->arr + mid, a->tmp + mid, a->len - mid };
+
+    if (a->len < CUTOFF) {
+        sort_task(&left);
+        sort_task(&right);
+    } else {
+        TPTask *t = tp_spawn(a->pool, sort_task, &left);
+        assert(t != NULL);
+        sort_task(&right);
+        assert(tp_sync(a->pool, t) == TP_OK);
+    }
+
+    merge(a->arr, a->tmp, mid, a->len);
+}
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    int *arr = malloc(sizeof(int) * N);
+    int *tmp = malloc(sizeof(int) * N);
+    assert(arr != NULL && tmp != NULL);
+
+    for (size_t i = 0; i < N; ++i) {
+        arr[i] = rand();
+    }
+
+    ThreadPool *pool = tp_create(WORKERS);
+    assert(pool != NULL);
+
+    SortArgs args = { pool, arr, tmp, N };
+    sort_task(&args);
+
+    for (size_t i = 1; i < N; ++i) {
+        assert(arr[i - 1] <= arr[i]);
+    }
+
+    tp_destroy(pool);
+    free(arr);
+    free(tmp);
+
+    printf("✓ thread_pool stress test passed: parallel merge sort of %d ints on %d workers\n", N, WORKERS);
+    return EXIT_SUCCESS;
+}
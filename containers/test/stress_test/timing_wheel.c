@@ -0,0 +1,100 @@
+#include "timing_wheel.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define N 2000000          // timers scheduled
+#define CANCEL_PERCENT 90  // most timeouts never fire
+#define RANGE (1u << 26)   // past the 256^3 ticks of the wheels: the overflow list is used
+#define RESOLUTION 4
+
+typedef struct {
+    uint64_t expires;
+    uint32_t id;
+} Timeout;
+
+typedef struct {
+    uint64_t prev_now;   // previous time given to tw_advance
+    uint64_t now;
+    unsigned char *state;
+    size_t fired;
+} Ctx;
+
+enum { PENDING, CANCELLED, FIRED };
+
+static TWTimer *timers[N];
+
+static void on_fire(void *elem, void *arg) {
+    Ctx *ctx = arg;
+    Timeout *t = elem;
+
+    /* never early, and in the first advance that reached its tick */
+    uint64_t tick = (t->expires + RESOLUTION - 1) / RESOLUTION;
+    assert(t->expires <= ctx->now);
+    assert(tick > ctx->prev_now / RESOLUTION);
+
+    assert(ctx->state[t->id] == PENDING);
+    ctx->state[t->id] = FIRED;
+    ctx->fired++;
+}
+
+static double elapsed_ms(struct timespec start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return ((end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6);
+}
+
+int main(void) {
+    srand((unsigned int)time(NULL));
+
+    TimingWheel *tw = tw_create(sizeof(Timeout), 0, RESOLUTION, 3);
+    assert(tw != NULL);
+
+    Ctx ctx = { 0, 0, calloc(N, 1), 0 };
+    assert(ctx.state != NULL);
+
+    /* arm and mostly cancel, while time moves forward */
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    size_t cancelled = 0;
+    for (uint32_t i = 0; i < N; ++i) {
+        Timeout t = { ctx.now + (uint64_t)rand() % RANGE, i };
+        timers[i] = tw_schedule(tw, t.expires, &t);
+        assert(timers[i] != NULL);
+
+        /* cancel a recent timer that hasn't fired */
+        uint32_t victim = i - (uint32_t)rand() % (i + 1 < 64 ? i + 1 : 64);
+        if (ctx.state[victim] == PENDING && rand() % 100 < CANCEL_PERCENT) {
+            assert(tw_cancel(tw, timers[victim]) == TW_OK);
+            ctx.state[victim] = CANCELLED;
+            cancelled++;
+        }
+
+        if (i % 16 == 0) {
+            ctx.prev_now = ctx.now;
+            ctx.now += (uint64_t)rand() % 64;
+            tw_advance(tw, ctx.now, on_fire, &ctx);
+        }
+    }
+    double arm_ms = elapsed_ms(start);
+
+    /* everything left fires */
+    ctx.prev_now = ctx.now;
+    ctx.now += 2 * (uint64_t)RANGE;
+    tw_advance(tw, ctx.now, on_fire, &ctx);
+    assert(tw_is_empty(tw));
+
+    for (size_t i = 0; i < N; ++i) {
+        assert(ctx.state[i] != PENDING);
+    }
+    assert(ctx.fired + cancelled == N);
+
+    tw_destroy(tw);
+    free(ctx.state);
+
+    printf("✓ timing_wheel stress test passed: %d timers (%zu cancelled, %zu fired), armed in %.1f ms\n",
+        N, cancelled, ctx.fired, arm_ms);
+    return (EXIT_SUCCESS);
+}
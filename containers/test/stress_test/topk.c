@@ -0,0 +1,73 @@
+#include "topk.h"
+#include "priority_queue.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define N 2000000   // stream length
+#define K 1000
+
+static int int_cmp(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return ((x > y) - (x < y));
+}
+
+static int int_desc_cmp(const void *a, const void *b) {
+    return (int_cmp(b, a));
+}
+
+static double elapsed_ms(struct timespec start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return ((end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6);
+}
+
+static int stream[N];
+
+int main(void) {
+    srand((unsigned int)time(NULL));
+
+    for (size_t i = 0; i < N; ++i) {
+        stream[i] = rand();
+    }
+
+    TopK *topk = topk_create(K, sizeof(int), int_cmp);
+    assert(topk != NULL);
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < N; ++i) {
+        assert(topk_offer(topk, &stream[i]) != TOPK_ERR);
+    }
+    double topk_ms = elapsed_ms(start);
+
+    /* the same with a full priority queue, popped whenever it grows past K */
+    PriorityQueue *pq = pq_create(sizeof(int), int_cmp);
+    assert(pq != NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < N; ++i) {
+        assert(pq_push(pq, &stream[i]) == PQ_OK);
+        if (pq_size(pq) > K) {
+            assert(pq_pop(pq) == PQ_OK);
+        }
+    }
+    double pq_ms = elapsed_ms(start);
+
+    /* reference: the K first of the whole stream sorted */
+    static int result[K];
+    assert(topk_sorted(topk, result) == K);
+    qsort(stream, N, sizeof(int), int_desc_cmp);
+    for (size_t i = 0; i < K; ++i) {
+        assert(result[i] == stream[i]);
+    }
+    assert(*(int *)pq_top(pq) == stream[K - 1]);
+
+    topk_destroy(topk);
+    pq_destroy(pq);
+
+    printf("✓ topk stress test passed: top %d of %d: topk %.1f ms, priority_queue %.1f ms\n", K, N, topk_ms, pq_ms);
+    return (EXIT_SUCCESS);
+}
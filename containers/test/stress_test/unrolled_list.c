@@ -0,0 +1,84 @@
+#include "unrolled_list.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define N 1000000    // elements appended, then walked by index
+#define REF_CAP 8192 // size bound of the random edit phase
+#define OPS 300000   // random edits
+
+int main(void) {
+    srand((unsigned)time(NULL));
+
+    UnrolledList *list = ul_create(sizeof(int));
+    assert(list != NULL);
+
+    for (int i = 0; i < N; ++i) {
+        assert(ul_push_back(list, &i) == UL_OK);
+    }
+
+    /* sequential index loop: linear thanks to the node finger */
+    for (size_t i = 0; i < N; ++i) {
+        assert(*(int *)ul_get(list, i) == (int)i);
+    }
+
+    /* and backwards */
+    for (size_t i = N; i-- > 0; ) {
+        assert(*(int *)ul_get(list, i) == (int)i);
+    }
+
+    for (size_t i = 0; i < 1000; ++i) {
+        size_t index = (size_t)rand() % N;
+        assert(*(int *)ul_get(list, index) == (int)index);
+    }
+
+    /* random edits at any position, checked against a plain array */
+    ul_clear(list);
+    int *ref = malloc(sizeof(int) * REF_CAP);
+    size_t ref_size = 0;
+    assert(ref != NULL);
+
+    for (int i = 0; i < OPS; ++i) {
+        int op = rand() % 7;
+
+        if (op <= 2 && ref_size < REF_CAP) {
+            size_t index = (size_t)rand() % (ref_size + 1);
+            assert(ul_insert_at(list, index, &i) == UL_OK);
+            for (size_t j = ref_size; j > index; --j) {
+                ref[j] = ref[j - 1];
+            }
+            ref[index] = i;
+            ref_size++;
+        } else if (op == 3 && ref_size > 0) {
+            size_t index = (size_t)rand() % ref_size;
+            assert(ul_remove_at(list, index) == UL_OK);
+            for (size_t j = index; j + 1 < ref_size; ++j) {
+                ref[j] = ref[j + 1];
+            }
+            ref_size--;
+        } else if (op == 4 && ref_size > 0) {
+            assert(ul_pop_front(list) == UL_OK);
+            for (size_t j = 0; j + 1 < ref_size; ++j) {
+                ref[j] = ref[j + 1];
+            }
+            ref_size--;
+        } else if (op == 5 && ref_size > 0) {
+            assert(ul_pop_back(list) == UL_OK);
+            ref_size--;
+        } else if (ref_size > 0) {
+            size_t index = (size_t)rand() % ref_size;
+            assert(*(int *)ul_get(list, index) == ref[index]);
+        }
+    }
+
+    assert(ul_size(list) == ref_size);
+    for (size_t i = 0; i < ref_size; ++i) {
+        assert(*(int *)ul_get(list, i) == ref[i]);
+    }
+
+    free(ref);
+    ul_destroy(list);
+    printf("✓ unrolled_list stress test passed: %d appends, %d random edits, final size = %zu\n", N, OPS, ref_size);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,79 @@
+#include "ws_deque.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define N 1000000  // items pushed by the owner
+#define THIEVES 3
+
+static WSDeque *dq;
+static unsigned char *seen;        // seen[i] is set once item i was taken
+static atomic_int owner_done;
+static atomic_long taken;
+
+static void take(long *item) {
+    /* every item must be handed out exactly once */
+    assert(seen[*item] == 0);
+    seen[*item] = 1;
+    atomic_fetch_add(&taken, 1);
+}
+
+static void *thief_main(void *arg) {
+    (void)arg;
+    for (;;) {
+        long *item = wsd_steal(dq);
+        if (item != NULL) {
+            take(item);
+        } else if (atomic_load(&owner_done) && wsd_size(dq) == 0) {
+            break ;
+        } else {
+            sched_yield();
+        }
+    }
+    return (NULL);
+}
+
+int main(void) {
+    long *items = malloc(sizeof(long) * N);
+    seen = calloc(N, 1);
+    dq = wsd_create(64);
+    assert(items != NULL && seen != NULL && dq != NULL);
+
+    pthread_t thieves[THIEVES];
+    for (int i = 0; i < THIEVES; ++i) {
+        assert(pthread_create(&thieves[i], NULL, thief_main, NULL) == 0);
+    }
+
+    /* owner: push everything, popping every third step */
+    for (long i = 0; i < N; ++i) {
+        items[i] = i;
+        assert(wsd_push(dq, &items[i]) == WSD_OK);
+        if (i % 3 == 0) {
+            long *item = wsd_pop(dq);
+            if (item != NULL) {
+                take(item);
+            }
+        }
+    }
+
+    long *item;
+    while ((item = wsd_pop(dq)) != NULL) {
+        take(item);
+    }
+    atomic_store(&owner_done, 1);
+
+    for (int i = 0; i < THIEVES; ++i) {
+        pthread_join(thieves[i], NULL);
+    }
+
+    assert(atomic_load(&taken) == N);
+
+    wsd_destroy(dq);
+    free(items);
+    free((void *)seen);
+    printf("✓ ws_deque stress test passed: %d items, %d thieves\n", N, THIEVES);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,120 @@
+#include "deque.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static void test_create_and_destroy(void) {
+    Deque *dq = dq_create(sizeof(int));
+    assert(dq != NULL);
+    assert(dq_size(dq) == 0);
+    assert(dq_is_empty(dq));
+    assert(dq_front(dq) == NULL);
+    assert(dq_back(dq) == NULL);
+    assert(dq_pop_front(dq) == DQ_ERR);
+    assert(dq_pop_back(dq) == DQ_ERR);
+    dq_destroy(dq);
+    puts("✓ test_create_and_destroy passed");
+}
+
+static void test_push_both_ends(void) {
+    Deque *dq = dq_create(sizeof(int));
+
+    /* -999 ... -1, 0 ... 999 (crosses many block boundaries on both sides) */
+    for (int i = 0; i < 1000; ++i) {
+        int back = i, front = -(i + 1);
+        assert(dq_push_back(dq, &back) == DQ_OK);
+        assert(dq_push_front(dq, &front) == DQ_OK);
+    }
+
+    assert(dq_size(dq) == 2000);
+    assert(*(int *)dq_front(dq) == -1000);
+    assert(*(int *)dq_back(dq) == 999);
+
+    for (size_t i = 0; i < 2000; ++i) {
+        assert(*(int *)dq_get(dq, i) == (int)i - 1000);
+    }
+
+    assert(dq_get(dq, 2000) == NULL);
+
+    dq_destroy(dq);
+    puts("✓ test_push_both_ends passed");
+}
+
+static void test_pointer_stability(void) {
+    Deque *dq = dq_create(sizeof(int));
+    int val = 42;
+
+    assert(dq_push_back(dq, &val) == DQ_OK);
+    int *first = dq_front(dq);
+
+    /* growing at both ends must never move existing elements */
+    for (int i = 0; i < 10000; ++i) {
+        assert(dq_push_back(dq, &i) == DQ_OK);
+        assert(dq_push_front(dq, &i) == DQ_OK);
+    }
+
+    assert(first == dq_get(dq, 10000));
+    assert(*first == 42);
+
+    dq_destroy(dq);
+    puts("✓ test_pointer_stability passed");
+}
+
+static void test_pop_and_set(void) {
+    Deque *dq = dq_create(sizeof(int));
+
+    for (int i = 0; i < 100; ++i) {
+        assert(dq_push_back(dq, &i) == DQ_OK);
+    }
+
+    int v = -5;
+    assert(dq_set(dq, 50, &v) == DQ_OK);
+    assert(*(int *)dq_get(dq, 50) == -5);
+    assert(dq_set(dq, 100, &v) == DQ_ERR);
+
+    for (int i = 0; i < 40; ++i) {
+        assert(dq_pop_front(dq) == DQ_OK);
+        assert(dq_pop_back(dq) == DQ_OK);
+    }
+
+    assert(dq_size(dq) == 20);
+    assert(*(int *)dq_front(dq) == 40);
+    assert(*(int *)dq_back(dq) == 59);
+
+    dq_clear(dq);
+    assert(dq_is_empty(dq));
+
+    /* reusable after clear */
+    assert(dq_push_front(dq, &v) == DQ_OK);
+    assert(*(int *)dq_back(dq) == -5);
+
+    dq_destroy(dq);
+    puts("✓ test_pop_and_set passed");
+}
+
+static void test_null_inputs(void) {
+    int v = 0;
+    assert(dq_create(0) == NULL);
+    assert(dq_push_front(NULL, &v) == DQ_ERR);
+    assert(dq_push_back(NULL, &v) == DQ_ERR);
+    assert(dq_pop_front(NULL) == DQ_ERR);
+    assert(dq_pop_back(NULL) == DQ_ERR);
+    assert(dq_front(NULL) == NULL);
+    assert(dq_back(NULL) == NULL);
+    assert(dq_get(NULL, 0) == NULL);
+    assert(dq_size(NULL) == 0);
+    assert(dq_is_empty(NULL));
+    dq_clear(NULL);
+    dq_destroy(NULL);
+    puts("✓ test_null_inputs passed");
+}
+
+int main(void) {
+    test_create_and_destroy();
+    test_push_both_ends();
+    test_pointer_stability();
+    test_pop_and_set();
+    test_null_inputs();
+    puts("🎉 all deque unit tests passed");
+    return EXIT_SUCCESS;
+}
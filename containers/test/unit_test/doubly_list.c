@@ -8,6 +8,8 @@ void test_create_and_destroy() {
     assert(list != NULL);
     assert(dl_size(list) == 0);
     assert(dl_is_empty(list) == 1);
+    assert(dl_front(list) == NULL);
+    assert(dl_back(list) == NULL);
     dl_destroy(list);
     printf("✅ test_create_and_destroy passed\n");
 }
@@ -76,11 +78,322 @@ void test_clear_and_empty() {
     printf("✅ test_clear_and_empty passed\n");
 }
 
+void test_cursor_walk_and_edit() {
+    DoublyList *list = dl_create(sizeof(int));
+
+    for (int i = 0; i < 10; ++i) {
+        dl_push_back(list, &i);
+    }
+
+    /* drop odd values, duplicate multiples of 3 (one linear pass) */
+    DLCursor cur = dl_cursor_begin(list);
+    while (!dl_cursor_is_end(&cur)) {
+        int v = *(int *)dl_cursor_get(&cur);
+        if (v % 2 != 0) {
+            assert(dl_cursor_erase(&cur) == DL_OK);
+            continue ;
+        }
+        if (v % 3 == 0) {
+            assert(dl_cursor_insert_before(&cur, &v) == DL_OK);
+        }
+        assert(dl_cursor_next(&cur) == DL_OK);
+    }
+
+    /* 0 0 2 4 6 6 8 */
+    int expected[] = {0, 0, 2, 4, 6, 6, 8};
+    assert(dl_size(list) == 7);
+    for (size_t i = 0; i < 7; ++i) {
+        assert(*(int *)dl_get(list, i) == expected[i]);
+    }
+    assert(dl_cursor_next(&cur) == DL_ERR);  // already past the end
+    assert(dl_cursor_erase(&cur) == DL_ERR);
+
+    /* walk backwards, inserting after the last and before the first positions */
+    int x = 100, y = -100;
+    cur = dl_cursor_last(list);
+    assert(dl_cursor_insert_after(&cur, &x) == DL_OK);
+    while (dl_cursor_prev(&cur) == DL_OK) {
+        ;
+    }
+    assert(dl_cursor_is_end(&cur));  // before the first element
+    assert(dl_cursor_get(&cur) == NULL);
+    assert(dl_cursor_insert_after(&cur, &y) == DL_OK);
+    assert(*(int *)dl_front(list) == -100);
+    assert(*(int *)dl_back(list) == 100);
+    assert(dl_size(list) == 9);
+
+    /* empty list */
+    dl_clear(list);
+    cur = dl_cursor_begin(list);
+    assert(dl_cursor_is_end(&cur));
+    assert(dl_cursor_insert_before(&cur, &x) == DL_OK);
+    assert(*(int *)dl_front(list) == 100);
+
+    dl_destroy(list);
+    printf("✅ test_cursor_walk_and_edit passed\n");
+}
+
+typedef struct Pair {
+    int key;
+    int seq;   // insertion order, to check stability
+} Pair;
+
+static int cmp_pair(const void *a, const void *b) {
+    return (((const Pair *)a)->key - ((const Pair *)b)->key);
+}
+
+static void test_sort_merge_splice(void) {
+    DoublyList *a = dl_create(sizeof(Pair));
+    DoublyList *b = dl_create(sizeof(Pair));
+    int keys[] = {5, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+
+    assert(dl_sort(a, cmp_pair) == DL_OK);  // empty
+    for (int i = 0; i < 10; ++i) {
+        Pair p = { keys[i], i };
+        dl_push_back(a, &p);
+    }
+
+    /* a cursor keeps its element across the sort */
+    DLCursor nine = dl_cursor_begin(a);
+    while (((Pair *)dl_cursor_get(&nine))->key != 9) {
+        dl_cursor_next(&nine);
+    }
+
+    assert(dl_sort(a, cmp_pair) == DL_OK);
+    assert(dl_size(a) == 10);
+    for (size_t i = 1; i < 10; ++i) {
+        Pair *prev = dl_get(a, i - 1), *curr = dl_get(a, i);
+        assert(prev->key < curr->key || (prev->key == curr->key && prev->seq < curr->seq));
+    }
+    assert(((Pair *)dl_cursor_get(&nine))->key == 9);
+    assert(((Pair *)dl_back(a))->key == 9);
+
+    /* backward links are consistent */
+    DLCursor cur = dl_cursor_last(a);
+    for (int i = 9; i >= 0; --i) {
+        assert(dl_cursor_get(&cur) == dl_get(a, (size_t)i));
+        dl_cursor_prev(&cur);
+    }
+
+    /* merge: ties keep the elements of `a` first */
+    int more[] = {0, 1, 5, 10};
+    for (int i = 0; i < 4; ++i) {
+        Pair p = { more[i], 100 + i };
+        dl_push_back(b, &p);
+    }
+    assert(dl_merge(a, b, cmp_pair) == DL_OK);
+    assert(dl_size(a) == 14 && dl_size(b) == 0);
+    assert(((Pair *)dl_front(a))->key == 0 && ((Pair *)dl_back(a))->key == 10);
+    for (size_t i = 1; i < 14; ++i) {
+        Pair *prev = dl_get(a, i - 1), *curr = dl_get(a, i);
+        assert(prev->key <= curr->key);
+        if (prev->key == curr->key) {
+            assert(prev->seq < curr->seq);
+        }
+    }
+
+    /* splice the first 3 elements of `a` to the (empty) `b` */
+    DLCursor first = dl_cursor_begin(a);
+    DLCursor last = dl_cursor_begin(a);
+    for (int i = 0; i < 3; ++i) {
+        dl_cursor_next(&last);
+    }
+    DLCursor pos = dl_cursor_begin(b);
+    assert(dl_splice(&pos, &first, &last, 0) == DL_ERR);   // count of a non-empty range
+    assert(dl_splice(&pos, &first, &last, 14) == DL_ERR);  // whole-list count of a partial range
+    assert(dl_splice(&pos, &first, &last, 3) == DL_OK);
+    assert(dl_size(a) == 11 && dl_size(b) == 3);
+    assert(first.list == b && ((Pair *)dl_cursor_get(&first))->key == 0);
+    assert(((Pair *)dl_back(b))->key == 1 && ((Pair *)dl_front(a))->key == 1);
+
+    /* splice within one list: move the front of `a` to its end */
+    first = dl_cursor_begin(a);
+    last = dl_cursor_begin(a);
+    dl_cursor_next(&last);
+    pos = dl_cursor_last(a);
+    dl_cursor_next(&pos);  // past the end
+    assert(dl_splice(&pos, &first, &last, 1) == DL_OK);
+    assert(dl_size(a) == 11 && ((Pair *)dl_back(a))->key == 1);
+
+    /* `pos` inside the range, or `last` before `first`, is rejected and changes nothing */
+    first = dl_cursor_begin(a);
+    pos = dl_cursor_begin(a);
+    dl_cursor_next(&pos);
+    last = pos;
+    dl_cursor_next(&last);
+    assert(dl_splice(&pos, &first, &last, 2) == DL_ERR);
+    assert(dl_splice(&first, &last, &pos, 1) == DL_ERR);
+    assert(dl_size(a) == 11 && ((Pair *)dl_back(a))->key == 1);
+    for (size_t i = 1; i < 10; ++i) {
+        assert(((Pair *)dl_get(a, i - 1))->key <= ((Pair *)dl_get(a, i))->key);
+    }
+
+    /* whole list back into `a`, at its front */
+    first = dl_cursor_begin(b);
+    last = dl_cursor_last(b);
+    dl_cursor_next(&last);
+    pos = dl_cursor_begin(a);
+    assert(dl_splice(&pos, &first, &last, 2) == DL_ERR);  // partial count of a whole list
+    assert(dl_splice(&pos, &first, &last, 3) == DL_OK);
+    assert(dl_size(a) == 14 && dl_is_empty(b));
+    assert(((Pair *)dl_front(a))->key == 0);
+
+    /* the lists now share their nodes' pool: clearing or destroying one leaves the other intact */
+    Pair p = { 7, 7 };
+    dl_push_back(b, &p);
+    dl_clear(b);
+    dl_push_back(b, &p);
+    dl_destroy(b);
+    assert(dl_size(a) == 14 && ((Pair *)dl_front(a))->key == 0);
+    dl_push_back(a, &p);
+    assert(((Pair *)dl_back(a))->key == 7);
+
+    /* `a` and `c` both share their pool with another list: the four pools are joined */
+    DoublyList *c = dl_create(sizeof(Pair));
+    DoublyList *d = dl_create(sizeof(Pair));
+    DoublyList *e = dl_create(sizeof(Pair));
+    dl_push_back(d, &p);
+    first = dl_cursor_begin(d);
+    last = dl_cursor_last(d);
+    dl_cursor_next(&last);
+    pos = dl_cursor_begin(c);
+    assert(dl_splice(&pos, &first, &last, 1) == DL_OK);  // c and d share a pool
+    first = dl_cursor_last(a);
+    last = dl_cursor_last(a);
+    dl_cursor_next(&last);
+    pos = dl_cursor_begin(e);
+    assert(dl_splice(&pos, &first, &last, 1) == DL_OK);  // a and e share a pool
+    assert(dl_size(a) == 14 && dl_size(e) == 1);
+
+    first = dl_cursor_begin(a);
+    last = dl_cursor_begin(a);
+    dl_cursor_next(&last);
+    dl_cursor_next(&last);
+    pos = dl_cursor_begin(c);
+    assert(dl_splice(&pos, &first, &last, 2) == DL_OK);
+    assert(dl_size(a) == 12 && dl_size(c) == 3 && first.list == c);
+    assert(dl_cursor_get(&first) == dl_front(c));
+    assert(((Pair *)dl_front(c))->key == 0 && ((Pair *)dl_back(c))->key == 7);
+    dl_destroy(c);
+    dl_destroy(d);
+    dl_destroy(e);
+
+    assert(dl_sort(NULL, cmp_pair) == DL_ERR);
+    assert(dl_merge(a, NULL, cmp_pair) == DL_ERR);
+    dl_destroy(a);
+    printf("✅ test_sort_merge_splice passed\n");
+}
+
+static void test_compact(void) {
+    DoublyList *list = dl_create(sizeof(int));
+
+    /* inserting at the front scatters the nodes in reverse memory order */
+    for (int i = 99; i >= 0; --i) {
+        dl_insert_at(list, 0, &i);
+    }
+    for (int i = 0; i < 100; i += 3) {
+        dl_remove_at(list, (size_t)(i / 3 * 2));  // drops the multiples of 3, leaving holes in the pool
+    }
+    size_t n = dl_size(list);
+
+    assert(dl_compact(list) == DL_OK);
+    assert(dl_size(list) == n);
+
+    /* traversal order is now memory order, with a constant stride */
+    ptrdiff_t stride = (char *)dl_get(list, 1) - (char *)dl_get(list, 0);
+    assert(stride > 0);
+    for (size_t i = 1; i < n; ++i) {
+        assert((char *)dl_get(list, i) - (char *)dl_get(list, i - 1) == stride);
+    }
+    int prev = -1;
+    for (size_t i = 0; i < n; ++i) {
+        int v = *(int *)dl_get(list, i);
+        assert(v > prev && v % 3 != 0);
+        prev = v;
+    }
+
+    /* incremental: the list is edited between steps */
+    int x = 1000;
+    size_t steps = 0;
+    int status = dl_compact_step(list, 10);
+    while (status == DL_PENDING) {
+        dl_push_front(list, &x);
+        dl_remove_at(list, dl_size(list) / 2);
+        dl_pop_back(list);
+        status = dl_compact_step(list, 10);
+        steps++;
+    }
+    assert(status == DL_OK && steps > 0);
+    assert(*(int *)dl_front(list) == 1000);
+
+    /* compaction stops cleanly when the list is cleared mid-way */
+    for (int i = 0; i < 50; ++i) {
+        dl_insert_at(list, 0, &i);
+    }
+    assert(dl_compact_step(list, 5) == DL_PENDING);
+    dl_clear(list);
+    assert(dl_compact_step(list, 5) == DL_OK);  // nothing to do
+    dl_push_back(list, &x);
+    assert(dl_compact(list) == DL_OK);
+    assert(*(int *)dl_front(list) == 1000 && dl_size(list) == 1);
+
+    assert(dl_compact(NULL) == DL_ERR);
+    dl_destroy(list);
+    printf("✅ test_compact passed\n");
+}
+
+static void test_from_and_to_array(void) {
+    int values[] = {3, 1, 4, 1, 5, 9, 2, 6};
+    DoublyList *list = dl_from_array(sizeof(int), values, 8);
+
+    assert(list != NULL && dl_size(list) == 8);
+    assert(*(int *)dl_front(list) == 3 && *(int *)dl_back(list) == 6);
+
+    /* nodes come from one block, in array order */
+    ptrdiff_t stride = (char *)dl_get(list, 1) - (char *)dl_get(list, 0);
+    assert(stride > 0);
+    for (size_t i = 1; i < 8; ++i) {
+        assert((char *)dl_get(list, i) - (char *)dl_get(list, i - 1) == stride);
+    }
+
+    /* prev links are consistent */
+    DLCursor cur = dl_cursor_last(list);
+    for (int i = 7; i >= 0; --i) {
+        assert(*(int *)dl_cursor_get(&cur) == values[i]);
+        dl_cursor_prev(&cur);
+    }
+
+    int x = 7;
+    dl_push_back(list, &x);
+    dl_pop_front(list);
+
+    int out[16] = {0};
+    assert(dl_to_array(list, out, 16) == 8);
+    int expected[] = {1, 4, 1, 5, 9, 2, 6, 7};
+    for (size_t i = 0; i < 8; ++i) {
+        assert(out[i] == expected[i]);
+    }
+    assert(dl_to_array(list, out, 3) == 3 && out[2] == 1 && out[3] == 5);
+    assert(dl_to_array(list, NULL, 3) == 0);
+    dl_destroy(list);
+
+    list = dl_from_array(sizeof(int), NULL, 0);
+    assert(list != NULL && dl_is_empty(list));
+    assert(dl_to_array(list, out, 16) == 0);
+    dl_destroy(list);
+    assert(dl_from_array(sizeof(int), NULL, 4) == NULL);
+    printf("✅ test_from_and_to_array passed\n");
+}
+
 int main(void) {
     test_create_and_destroy();
     test_push_and_access();
     test_pop_and_remove();
     test_clear_and_empty();
+    test_cursor_walk_and_edit();
+    test_sort_merge_splice();
+    test_compact();
+    test_from_and_to_array();
     printf("✅ All unit tests passed.\n");
     return 0;
 }
@@ -87,6 +87,32 @@ void test_reallocation() {
     da_destroy(arr);
 }
 
+void test_append() {
+    DynamicArray *arr = da_create(2, sizeof(int));
+    int values[] = {1, 2, 3, 4, 5, 6, 7};
+    int x = 0;
+    da_push_back(arr, &x);
+    assert(da_append(arr, values, 7) == DA_OK);
+    assert(da_size(arr) == 8 && da_capacity(arr) == 8);  // doubled twice, one copy
+    for (int i = 0; i < 8; ++i) {
+        assert(*(int *)da_get(arr, i) == i);
+    }
+    assert(da_append(arr, NULL, 0) == DA_OK && da_size(arr) == 8);
+    assert(da_append(arr, NULL, 1) == DA_ERR);
+    assert(da_append(NULL, values, 1) == DA_ERR);
+    da_destroy(arr);
+}
+
+void test_data() {
+    DynamicArray *arr = da_create(2, sizeof(int));
+    for (int i = 0; i < 5; ++i) da_push_back(arr, &i);
+    int *data = da_data(arr);
+    assert(data == da_get(arr, 0));
+    for (int i = 0; i < 5; ++i) assert(data[i] == i);
+    assert(da_data(NULL) == NULL);
+    da_destroy(arr);
+}
+
 void test_clear() {
     DynamicArray *arr = da_create(4, sizeof(int));
     for (int i = 0; i < 4; ++i) da_push_back(arr, &i);
@@ -115,6 +141,8 @@ int main() {
     test_remove_at_boundaries();
     test_set_and_get();
     test_reallocation();
+    test_append();
+    test_data();
     test_clear();
     test_invalid_operations();
     printf("✅ All dynamic array unit tests passed!\n");
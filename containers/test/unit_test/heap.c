@@ -79,11 +79,112 @@ static void test_null_inputs() {
     puts("✓ test_null_inputs passed");
 }
 
+static void test_arity() {
+    size_t arities[] = { 2, 3, 4, 8, 16 };
+    for (size_t a = 0; a < 5; ++a) {
+        Heap *h = heap_create_arity(sizeof(int), int_min_cmp, arities[a]);
+        assert(h != NULL && heap_arity(h) == arities[a]);
+
+        /* a scrambled permutation of 0..999 comes out sorted */
+        for (int i = 0; i < 1000; ++i) {
+            int v = (i * 389) % 1000;
+            assert(heap_insert(h, &v) == HEAP_OK);
+        }
+        for (int i = 0; i < 1000; ++i) {
+            assert(*(int *)heap_peek(h) == i);
+            assert(heap_remove_top(h) == HEAP_OK);
+        }
+        assert(heap_is_empty(h));
+        heap_destroy(h);
+    }
+
+    Heap *binary = heap_create(sizeof(int), int_min_cmp);
+    assert(heap_arity(binary) == 2);
+    heap_destroy(binary);
+    assert(heap_create_arity(sizeof(int), int_min_cmp, 1) == NULL);
+    assert(heap_create_arity(sizeof(int), int_min_cmp, 17) == NULL);
+    assert(heap_arity(NULL) == 0);
+    puts("✓ test_arity passed");
+}
+
+static void test_create_from() {
+    int vals[] = { 9, 4, 7, 1, 8, 2, 6, 3, 5, 0, 4 };
+    Heap *h = heap_create_from(vals, 11, sizeof(int), int_max_cmp);
+    assert(h != NULL && heap_size(h) == 11);
+
+    /* the source buffer is copied, not adopted */
+    vals[0] = -1;
+
+    int expected[] = { 9, 8, 7, 6, 5, 4, 4, 3, 2, 1, 0 };
+    for (int i = 0; i < 11; ++i) {
+        assert(*(int *)heap_peek(h) == expected[i]);
+        assert(heap_remove_top(h) == HEAP_OK);
+    }
+    assert(heap_is_empty(h));
+
+    /* a heapified heap grows like any other */
+    for (int i = 0; i < 2000; ++i) {
+        assert(heap_insert(h, &i) == HEAP_OK);
+    }
+    assert(*(int *)heap_peek(h) == 1999);
+    heap_destroy(h);
+
+    h = heap_create_from(NULL, 0, sizeof(int), int_min_cmp);
+    assert(h != NULL && heap_is_empty(h));
+    heap_destroy(h);
+    assert(heap_create_from(NULL, 3, sizeof(int), int_min_cmp) == NULL);
+    assert(heap_create_from(vals, 3, sizeof(int), NULL) == NULL);
+    puts("✓ test_create_from passed");
+}
+
+/* the sift loops copy elements through a hole: check the order for element sizes with and without a fixed-size copy */
+typedef struct {
+    int key;
+    char pad[20];
+} Wide;
+
+static int wide_cmp(const void *a, const void *b) {
+    return (((const Wide *)a)->key - ((const Wide *)b)->key);
+}
+
+static void test_wide_elements_and_aliasing() {
+    Heap *h = heap_create_arity(sizeof(Wide), wide_cmp, 3);
+    assert(h != NULL);
+
+    for (int i = 0; i < 2000; ++i) {
+        Wide w = { .key = (i * 7919) % 2000 };
+        w.pad[19] = (char)w.key;
+        assert(heap_insert(h, &w) == HEAP_OK);
+    }
+
+    /* re-inserting the top from inside the buffer, across a reallocation */
+    Heap *small = heap_create(sizeof(int), int_min_cmp);
+    int v = 42;
+    assert(heap_insert(small, &v) == HEAP_OK);
+    for (int i = 0; i < 3000; ++i) {
+        assert(heap_insert(small, heap_peek(small)) == HEAP_OK);
+    }
+    assert(heap_size(small) == 3001 && *(int *)heap_peek(small) == 42);
+    heap_destroy(small);
+
+    for (int i = 0; i < 2000; ++i) {
+        Wide *top = heap_peek(h);
+        assert(top->key == i && top->pad[19] == (char)i);
+        assert(heap_remove_top(h) == HEAP_OK);
+    }
+
+    heap_destroy(h);
+    puts("✓ test_wide_elements_and_aliasing passed");
+}
+
 int main(void) {
     test_min_heap_basic();
     test_max_heap_order();
     test_remove_from_empty();
     test_null_inputs();
+    test_create_from();
+    test_arity();
+    test_wide_elements_and_aliasing();
     puts("🎉 all heap unit tests passed");
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,191 @@
+#include "index_list.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static int cmp_int(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return ((x > y) - (x < y));
+}
+
+static void check_values(IndexList *list, const int *expected, size_t n) {
+    assert(ixl_size(list) == n);
+    for (size_t i = 0; i < n; ++i) {
+        assert(*(int *)ixl_get(list, i) == expected[i]);
+    }
+}
+
+static void test_create_and_destroy(void) {
+    IndexList *list = ixl_create(sizeof(int));
+    assert(list != NULL);
+    assert(ixl_is_empty(list) && ixl_size(list) == 0);
+    assert(ixl_front(list) == NULL && ixl_back(list) == NULL);
+    assert(ixl_get(list, 0) == NULL);
+    assert(ixl_pop_front(list) == IXL_ERR && ixl_pop_back(list) == IXL_ERR);
+    ixl_destroy(list);
+
+    assert(ixl_create(0) == NULL);
+    ixl_destroy(NULL);
+    puts("✓ test_create_and_destroy passed");
+}
+
+static void test_push_insert_remove(void) {
+    IndexList *list = ixl_create(sizeof(int));
+    int values[] = {10, 20, 30, 40};
+
+    ixl_push_back(list, &values[1]);   // 20
+    ixl_push_front(list, &values[0]);  // 10 20
+    ixl_push_back(list, &values[3]);   // 10 20 40
+    assert(ixl_insert_at(list, 2, &values[2]) == IXL_OK);  // 10 20 30 40
+    assert(ixl_insert_at(list, 5, &values[2]) == IXL_ERR);
+    check_values(list, values, 4);
+    assert(*(int *)ixl_front(list) == 10 && *(int *)ixl_back(list) == 40);
+
+    assert(ixl_remove_at(list, 1) == IXL_OK);  // 10 30 40
+    assert(ixl_remove_at(list, 3) == IXL_ERR);
+    int after_remove[] = {10, 30, 40};
+    check_values(list, after_remove, 3);
+
+    assert(ixl_pop_front(list) == IXL_OK);
+    assert(ixl_pop_back(list) == IXL_OK);
+    assert(*(int *)ixl_front(list) == 30 && ixl_size(list) == 1);
+
+    /* freed slots are recycled, then the array grows past its first capacity */
+    for (int i = 0; i < 1000; ++i) {
+        assert(ixl_push_back(list, &i) == IXL_OK);
+    }
+    assert(ixl_size(list) == 1001);
+    for (size_t i = 1; i < 1001; ++i) {
+        assert(*(int *)ixl_get(list, i) == (int)i - 1);
+    }
+
+    ixl_clear(list);
+    assert(ixl_is_empty(list) && ixl_front(list) == NULL);
+    ixl_push_front(list, &values[0]);
+    assert(*(int *)ixl_get(list, 0) == 10);
+
+    assert(ixl_push_back(NULL, &values[0]) == IXL_ERR);
+    assert(ixl_push_back(list, NULL) == IXL_ERR);
+    ixl_destroy(list);
+    puts("✓ test_push_insert_remove passed");
+}
+
+static void test_cursor_walk_and_edit(void) {
+    IndexList *list = ixl_create(sizeof(int));
+
+    for (int i = 0; i < 10; ++i) {
+        ixl_push_back(list, &i);
+    }
+
+    /* drop odd values, duplicate multiples of 3 */
+    IXLCursor cur = ixl_cursor_begin(list);
+    while (!ixl_cursor_is_end(&cur)) {
+        int v = *(int *)ixl_cursor_get(&cur);
+        if (v % 2 != 0) {
+            assert(ixl_cursor_erase(&cur) == IXL_OK);
+            continue ;
+        }
+        if (v % 3 == 0) {
+            assert(ixl_cursor_insert_before(&cur, &v) == IXL_OK);
+        }
+        assert(ixl_cursor_next(&cur) == IXL_OK);
+    }
+    int expected[] = {0, 0, 2, 4, 6, 6, 8};
+    check_values(list, expected, 7);
+    assert(ixl_cursor_next(&cur) == IXL_ERR);
+    assert(ixl_cursor_erase(&cur) == IXL_ERR);
+
+    /* the end position appends before it and prepends after it */
+    int x = 100, y = -100;
+    assert(ixl_cursor_insert_before(&cur, &x) == IXL_OK);
+    assert(ixl_cursor_insert_after(&cur, &y) == IXL_OK);
+    assert(*(int *)ixl_front(list) == -100 && *(int *)ixl_back(list) == 100);
+
+    /* walk backwards, from the last element, then from the end position */
+    cur = ixl_cursor_last(list);
+    size_t steps = 1;
+    assert(ixl_cursor_get(&cur) == ixl_back(list));
+    while (ixl_cursor_prev(&cur) == IXL_OK) {
+        assert(ixl_cursor_get(&cur) == ixl_get(list, ixl_size(list) - 1 - steps));
+        steps++;
+    }
+    assert(steps == 9);
+    assert(ixl_cursor_get(&cur) == ixl_front(list));
+
+    cur = ixl_cursor_begin(list);
+    while (!ixl_cursor_is_end(&cur)) {
+        assert(ixl_cursor_next(&cur) == IXL_OK);
+    }
+    steps = 0;
+    while (ixl_cursor_prev(&cur) == IXL_OK) {
+        assert(ixl_cursor_get(&cur) == ixl_get(list, ixl_size(list) - 1 - steps));
+        steps++;
+    }
+    assert(steps == 9);
+
+    ixl_destroy(list);
+    puts("✓ test_cursor_walk_and_edit passed");
+}
+
+static void test_push_own_element_on_growth(void) {
+    IndexList *list = ixl_create(sizeof(int));
+    int v = 42;
+
+    /* the first growth happens when the 16 initial slots (sentinel included) are used */
+    ixl_push_back(list, &v);
+    for (int i = 1; i < 15; ++i) {
+        ixl_push_back(list, &i);
+    }
+    assert(ixl_size(list) == 15);
+
+    /* the list's own front element is copied as the buffer moves */
+    assert(ixl_push_back(list, ixl_front(list)) == IXL_OK);
+    assert(ixl_push_back(list, ixl_front(list)) == IXL_OK);
+    assert(*(int *)ixl_get(list, 15) == 42 && *(int *)ixl_back(list) == 42);
+
+    ixl_destroy(list);
+    puts("✓ test_push_own_element_on_growth passed");
+}
+
+static void test_sort(void) {
+    IndexList *list = ixl_create(sizeof(int));
+    int values[] = {5, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+
+    assert(ixl_sort(list, cmp_int) == IXL_OK);  // empty
+    for (int i = 0; i < 10; ++i) {
+        ixl_push_back(list, &values[i]);
+    }
+
+    /* elements don't move: a cursor keeps its element */
+    IXLCursor nine = ixl_cursor_begin(list);
+    for (int i = 0; i < 5; ++i) {
+        ixl_cursor_next(&nine);
+    }
+
+    assert(ixl_sort(list, cmp_int) == IXL_OK);
+    int sorted[] = {1, 1, 2, 3, 4, 5, 5, 5, 6, 9};
+    check_values(list, sorted, 10);
+    assert(*(int *)ixl_cursor_get(&nine) == 9);
+    assert(ixl_cursor_next(&nine) == IXL_OK && ixl_cursor_is_end(&nine));
+
+    /* prev links are consistent */
+    IXLCursor cur = ixl_cursor_last(list);
+    for (int i = 9; i >= 0; --i) {
+        assert(*(int *)ixl_cursor_get(&cur) == sorted[i]);
+        ixl_cursor_prev(&cur);
+    }
+
+    assert(ixl_sort(list, NULL) == IXL_ERR);
+    ixl_destroy(list);
+    puts("✓ test_sort passed");
+}
+
+int main(void) {
+    test_create_and_destroy();
+    test_push_insert_remove();
+    test_cursor_walk_and_edit();
+    test_push_own_element_on_growth();
+    test_sort();
+    puts("🎉 all index_list unit tests passed");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,152 @@
+#include "indexed_pq.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static int int_min_cmp(const void *a, const void *b) {
+    return (*(const int *)a - *(const int *)b);
+}
+
+static void test_push_pop_order() {
+    IndexedPQ *ipq = ipq_create(sizeof(int), int_min_cmp);
+    assert(ipq != NULL);
+    assert(ipq_is_empty(ipq));
+    assert(ipq_top(ipq) == NULL);
+    assert(ipq_top_handle(ipq) == IPQ_NO_HANDLE);
+
+    int vals[] = { 6, 3, 9, 1, 5 };
+    size_t handles[5];
+    for (int i = 0; i < 5; ++i) {
+        handles[i] = ipq_push(ipq, &vals[i]);
+        assert(handles[i] != IPQ_NO_HANDLE);
+        assert(*(int *)ipq_get(ipq, handles[i]) == vals[i]);
+    }
+
+    assert(ipq_size(ipq) == 5);
+    assert(ipq_top_handle(ipq) == handles[3]);
+
+    int last = -1;
+    while (!ipq_is_empty(ipq)) {
+        int *top = ipq_top(ipq);
+        assert(*top >= last);
+        last = *top;
+        assert(ipq_pop(ipq) == IPQ_OK);
+    }
+
+    for (int i = 0; i < 5; ++i) {
+        assert(!ipq_contains(ipq, handles[i]));
+    }
+
+    assert(ipq_pop(ipq) == IPQ_ERR);
+    ipq_destroy(ipq);
+    puts("✓ test_push_pop_order passed");
+}
+
+static void test_update() {
+    IndexedPQ *ipq = ipq_create(sizeof(int), int_min_cmp);
+    int vals[] = { 10, 20, 30, 40 };
+    size_t handles[4];
+    for (int i = 0; i < 4; ++i) {
+        handles[i] = ipq_push(ipq, &vals[i]);
+    }
+
+    /* decrease-key */
+    int v = 5;
+    assert(ipq_update(ipq, handles[3], &v) == IPQ_OK);
+    assert(ipq_top_handle(ipq) == handles[3]);
+
+    /* increase-key */
+    v = 50;
+    assert(ipq_update(ipq, handles[3], &v) == IPQ_OK);
+    assert(ipq_top_handle(ipq) == handles[0]);
+
+    /* in place, then re-sift with the same pointer */
+    int *elem = ipq_get(ipq, handles[2]);
+    *elem = 1;
+    assert(ipq_update(ipq, handles[2], elem) == IPQ_OK);
+    assert(ipq_top_handle(ipq) == handles[2]);
+
+    assert(ipq_size(ipq) == 4);
+    ipq_destroy(ipq);
+    puts("✓ test_update passed");
+}
+
+static void test_remove_and_reuse() {
+    IndexedPQ *ipq = ipq_create(sizeof(int), int_min_cmp);
+    size_t handles[6];
+    for (int i = 0; i < 6; ++i) {
+        handles[i] = ipq_push(ipq, &i);
+    }
+
+    assert(ipq_remove(ipq, handles[0]) == IPQ_OK);
+    assert(ipq_remove(ipq, handles[4]) == IPQ_OK);
+    assert(ipq_remove(ipq, handles[4]) == IPQ_ERR);
+    assert(!ipq_contains(ipq, handles[4]));
+    assert(ipq_get(ipq, handles[4]) == NULL);
+    assert(ipq_size(ipq) == 4);
+    assert(*(int *)ipq_top(ipq) == 1);
+
+    /* a released handle is handed out again */
+    int v = -1;
+    size_t h = ipq_push(ipq, &v);
+    assert(h == handles[0] || h == handles[4]);
+    assert(ipq_top_handle(ipq) == h);
+
+    int expected[] = { -1, 1, 2, 3, 5 };
+    for (int i = 0; i < 5; ++i) {
+        assert(*(int *)ipq_top(ipq) == expected[i]);
+        assert(ipq_pop(ipq) == IPQ_OK);
+    }
+
+    ipq_destroy(ipq);
+    puts("✓ test_remove_and_reuse passed");
+}
+
+static void test_push_own_element() {
+    IndexedPQ *ipq = ipq_create(sizeof(int), int_min_cmp);
+
+    /* 64 handles fill the initial capacity, the next push grows it */
+    for (int i = 0; i < 64; ++i) {
+        int v = 100 + i;
+        assert(ipq_push(ipq, &v) != IPQ_NO_HANDLE);
+    }
+
+    size_t h = ipq_push(ipq, ipq_top(ipq));
+    assert(h == 64);
+    assert(*(int *)ipq_get(ipq, h) == 100);
+
+    ipq_destroy(ipq);
+    puts("✓ test_push_own_element passed");
+}
+
+static void test_invalid_inputs() {
+    int v = 1;
+    assert(ipq_create(0, int_min_cmp) == NULL);
+    assert(ipq_create(sizeof(int), NULL) == NULL);
+    assert(ipq_push(NULL, &v) == IPQ_NO_HANDLE);
+    assert(ipq_pop(NULL) == IPQ_ERR);
+    assert(ipq_update(NULL, 0, &v) == IPQ_ERR);
+    assert(ipq_remove(NULL, 0) == IPQ_ERR);
+    assert(!ipq_contains(NULL, 0));
+    assert(ipq_size(NULL) == 0);
+    assert(ipq_is_empty(NULL));
+
+    IndexedPQ *ipq = ipq_create(sizeof(int), int_min_cmp);
+    assert(ipq_push(ipq, NULL) == IPQ_NO_HANDLE);
+    assert(ipq_update(ipq, 0, &v) == IPQ_ERR);
+    assert(ipq_update(ipq, IPQ_NO_HANDLE, &v) == IPQ_ERR);
+    size_t h = ipq_push(ipq, &v);
+    assert(ipq_update(ipq, h, NULL) == IPQ_ERR);
+    ipq_destroy(ipq);
+    puts("✓ test_invalid_inputs passed");
+}
+
+int main(void) {
+    test_push_pop_order();
+    test_update();
+    test_remove_and_reuse();
+    test_push_own_element();
+    test_invalid_inputs();
+    puts("🎉 all indexed_pq unit tests passed");
+    return (0);
+}
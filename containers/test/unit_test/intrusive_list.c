@@ -0,0 +1,168 @@
+#include "intrusive_list.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct Item {
+    int value;
+    IListLink link;
+} Item;
+
+static int value_of(IListLink *link) {
+    return (ILIST_ENTRY(link, Item, link)->value);
+}
+
+static void init_items(Item *items, int n) {
+    for (int i = 0; i < n; ++i) {
+        items[i].value = i;
+        ilist_link_init(&items[i].link);
+    }
+}
+
+static void test_push_and_iterate(void) {
+    IList list;
+    Item items[4];
+
+    ilist_init(&list);
+    init_items(items, 4);
+    assert(ilist_is_empty(&list));
+    assert(ilist_front(&list) == NULL && ilist_back(&list) == NULL);
+
+    assert(ilist_push_back(&list, &items[1].link) == ILIST_OK);
+    assert(ilist_push_back(&list, &items[2].link) == ILIST_OK);
+    assert(ilist_push_front(&list, &items[0].link) == ILIST_OK);
+    assert(ilist_size(&list) == 3);
+    assert(ilist_is_linked(&items[0].link));
+    assert(!ilist_is_linked(&items[3].link));
+
+    int expected = 0;
+    for (IListLink *it = ilist_front(&list); it != NULL; it = ilist_next(&list, it)) {
+        assert(value_of(it) == expected++);
+    }
+    assert(expected == 3);
+
+    for (IListLink *it = ilist_back(&list); it != NULL; it = ilist_prev(&list, it)) {
+        assert(value_of(it) == --expected);
+    }
+    assert(expected == 0);
+
+    /* a link can only be in one list at a time */
+    assert(ilist_push_back(&list, &items[1].link) == ILIST_ERR);
+    assert(ilist_size(&list) == 3);
+
+    puts("✓ test_push_and_iterate passed");
+}
+
+static void test_insert_and_remove(void) {
+    IList list;
+    Item items[5];
+
+    ilist_init(&list);
+    init_items(items, 5);
+
+    ilist_push_back(&list, &items[0].link);
+    ilist_push_back(&list, &items[4].link);
+    assert(ilist_insert_after(&list, &items[0].link, &items[1].link) == ILIST_OK);
+    assert(ilist_insert_before(&list, &items[4].link, &items[3].link) == ILIST_OK);
+    assert(ilist_insert_before(&list, &items[3].link, &items[2].link) == ILIST_OK);
+
+    /* `pos` must be in the list */
+    Item stray = { 42, { NULL, NULL } };
+    Item other = { 43, { NULL, NULL } };
+    assert(ilist_insert_after(&list, &stray.link, &other.link) == ILIST_ERR);
+
+    int expected = 0;
+    for (IListLink *it = ilist_front(&list); it != NULL; it = ilist_next(&list, it)) {
+        assert(value_of(it) == expected++);
+    }
+    assert(expected == 5);
+
+    assert(ilist_remove(&list, &items[2].link) == ILIST_OK);
+    assert(!ilist_is_linked(&items[2].link));
+    assert(ilist_remove(&list, &items[2].link) == ILIST_ERR);
+    assert(ilist_size(&list) == 4);
+    assert(value_of(ilist_next(&list, &items[1].link)) == 3);
+
+    assert(value_of(ilist_pop_front(&list)) == 0);
+    assert(value_of(ilist_pop_back(&list)) == 4);
+    assert(ilist_size(&list) == 2);
+
+    ilist_clear(&list);
+    assert(ilist_is_empty(&list));
+    assert(!ilist_is_linked(&items[1].link) && !ilist_is_linked(&items[3].link));
+    assert(ilist_pop_front(&list) == NULL);
+
+    /* unlinked objects can be reused right away */
+    assert(ilist_push_back(&list, &items[3].link) == ILIST_OK);
+    assert(ilist_size(&list) == 1);
+
+    puts("✓ test_insert_and_remove passed");
+}
+
+static void test_move(void) {
+    IList a, b;
+    Item items[3];
+
+    ilist_init(&a);
+    ilist_init(&b);
+    init_items(items, 3);
+
+    for (int i = 0; i < 3; ++i) {
+        ilist_push_back(&a, &items[i].link);
+    }
+
+    /* LRU touch: same list */
+    assert(ilist_move_to_front(&a, &a, &items[2].link) == ILIST_OK);
+    assert(value_of(ilist_front(&a)) == 2 && value_of(ilist_back(&a)) == 1);
+    assert(ilist_size(&a) == 3);
+
+    assert(ilist_move_to_back(&a, &a, &items[2].link) == ILIST_OK);
+    assert(value_of(ilist_back(&a)) == 2);
+
+    /* between lists */
+    assert(ilist_move_to_back(&b, &a, &items[0].link) == ILIST_OK);
+    assert(ilist_move_to_front(&b, &a, &items[2].link) == ILIST_OK);
+    assert(ilist_size(&a) == 1 && ilist_size(&b) == 2);
+    assert(value_of(ilist_front(&b)) == 2 && value_of(ilist_back(&b)) == 0);
+    assert(value_of(ilist_front(&a)) == 1);
+
+    /* unlinked links cannot be moved */
+    Item stray = { 42, { NULL, NULL } };
+    assert(ilist_move_to_back(&b, &a, &stray.link) == ILIST_ERR);
+    assert(ilist_size(&a) == 1 && ilist_size(&b) == 2);
+
+    puts("✓ test_move passed");
+}
+
+static void test_null_inputs(void) {
+    IListLink link = { NULL, NULL };
+
+    ilist_init(NULL);
+    ilist_link_init(NULL);
+    ilist_clear(NULL);
+    assert(ilist_push_front(NULL, &link) == ILIST_ERR);
+    assert(ilist_push_back(NULL, &link) == ILIST_ERR);
+    assert(ilist_remove(NULL, &link) == ILIST_ERR);
+    assert(ilist_pop_back(NULL) == NULL);
+    assert(ilist_front(NULL) == NULL);
+    assert(ilist_size(NULL) == 0);
+    assert(ilist_is_empty(NULL));
+    assert(!ilist_is_linked(NULL));
+
+    IList list;
+    ilist_init(&list);
+    assert(ilist_push_back(&list, NULL) == ILIST_ERR);
+    assert(ilist_remove(&list, &link) == ILIST_ERR);
+    assert(ilist_move_to_front(&list, &list, &link) == ILIST_ERR);
+
+    puts("✓ test_null_inputs passed");
+}
+
+int main(void) {
+    test_push_and_iterate();
+    test_insert_and_remove();
+    test_move();
+    test_null_inputs();
+    puts("🎉 all intrusive_list unit tests passed");
+    return EXIT_SUCCESS;
+}
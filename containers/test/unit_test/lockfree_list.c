@@ -0,0 +1,104 @@
+#include "lockfree_list.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static int cmp_int(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return ((x > y) - (x < y));
+}
+
+static void test_create_and_destroy(void) {
+    LockFreeList *list = lfl_create(sizeof(int), cmp_int);
+    assert(list != NULL);
+    assert(lfl_is_empty(list) && lfl_size(list) == 0);
+    int value;
+    assert(lfl_pop_front(list, &value) == LFL_ERR);
+    assert(lfl_find(list, &value, NULL) == LFL_ERR);
+    lfl_destroy(list);
+
+    assert(lfl_create(0, cmp_int) == NULL);
+    lfl_destroy(NULL);
+    puts("✓ test_create_and_destroy passed");
+}
+
+static void test_push_and_pop_front(void) {
+    LockFreeList *list = lfl_create(sizeof(int), NULL);
+
+    for (int i = 0; i < 100; ++i) {
+        assert(lfl_push_front(list, &i) == LFL_OK);
+    }
+    assert(lfl_size(list) == 100);
+
+    /* LIFO order */
+    for (int i = 99; i >= 0; --i) {
+        int value;
+        assert(lfl_pop_front(list, &value) == LFL_OK);
+        assert(value == i);
+    }
+    assert(lfl_is_empty(list));
+    assert(lfl_pop_front(list, NULL) == LFL_ERR);
+
+    /* ordered operations need a comparator */
+    int x = 1;
+    assert(lfl_insert(list, &x) == LFL_ERR);
+    assert(lfl_erase(list, &x) == LFL_ERR);
+    assert(lfl_find(list, &x, NULL) == LFL_ERR);
+
+    assert(lfl_push_front(NULL, &x) == LFL_ERR);
+    assert(lfl_push_front(list, NULL) == LFL_ERR);
+    lfl_destroy(list);
+    puts("✓ test_push_and_pop_front passed");
+}
+
+static void test_ordered_insert_and_erase(void) {
+    LockFreeList *list = lfl_create(sizeof(int), cmp_int);
+    int values[] = {5, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+
+    for (int i = 0; i < 10; ++i) {
+        assert(lfl_insert(list, &values[i]) == LFL_OK);
+    }
+
+    int key = 5, found = 0;
+    assert(lfl_find(list, &key, &found) == LFL_OK && found == 5);
+    key = 7;
+    assert(lfl_find(list, &key, NULL) == LFL_ERR);
+
+    /* erase removes one equal element at a time */
+    key = 5;
+    assert(lfl_erase(list, &key) == LFL_OK);
+    assert(lfl_erase(list, &key) == LFL_OK);
+    key = 7;
+    assert(lfl_erase(list, &key) == LFL_ERR);
+    assert(lfl_size(list) == 8);
+
+    /* popping the front drains it in sorted order */
+    int sorted[] = {1, 1, 2, 3, 4, 5, 6, 9};
+    for (int i = 0; i < 8; ++i) {
+        int value;
+        assert(lfl_pop_front(list, &value) == LFL_OK);
+        assert(value == sorted[i]);
+    }
+    assert(lfl_is_empty(list));
+
+    /* lots of churn goes through the reclamation */
+    for (int round = 0; round < 100; ++round) {
+        for (int i = 0; i < 50; ++i) {
+            lfl_insert(list, &i);
+        }
+        for (int i = 0; i < 50; ++i) {
+            assert(lfl_erase(list, &i) == LFL_OK);
+        }
+    }
+    assert(lfl_is_empty(list));
+    lfl_destroy(list);
+    puts("✓ test_ordered_insert_and_erase passed");
+}
+
+int main(void) {
+    test_create_and_destroy();
+    test_push_and_pop_front();
+    test_ordered_insert_and_erase();
+    puts("🎉 all lockfree_list unit tests passed");
+    return EXIT_SUCCESS;
+}
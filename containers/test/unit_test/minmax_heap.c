@@ -0,0 +1,103 @@
+#include "minmax_heap.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static int int_cmp(const void *a, const void *b) {
+    return (*(const int *)a - *(const int *)b);
+}
+
+static void test_both_ends() {
+    MinMaxHeap *mmh = mmh_create(sizeof(int), int_cmp);
+    assert(mmh != NULL);
+    assert(mmh_is_empty(mmh));
+    assert(mmh_peek_min(mmh) == NULL && mmh_peek_max(mmh) == NULL);
+    assert(mmh_pop_min(mmh) == MMH_ERR && mmh_pop_max(mmh) == MMH_ERR);
+
+    int vals[] = { 5, 3, 7, 1, 4, 9, 2, 8, 6, 0 };
+    for (int i = 0; i < 10; ++i) {
+        assert(mmh_insert(mmh, &vals[i]) == MMH_OK);
+    }
+    assert(mmh_size(mmh) == 10);
+
+    /* alternate ends: 0, 9, 1, 8, ... */
+    for (int i = 0; i < 5; ++i) {
+        assert(*(int *)mmh_peek_min(mmh) == i);
+        assert(*(int *)mmh_peek_max(mmh) == 9 - i);
+        assert(mmh_pop_min(mmh) == MMH_OK);
+        assert(mmh_pop_max(mmh) == MMH_OK);
+    }
+
+    assert(mmh_is_empty(mmh));
+    mmh_destroy(mmh);
+    puts("✓ test_both_ends passed");
+}
+
+static void test_small_sizes() {
+    MinMaxHeap *mmh = mmh_create(sizeof(int), int_cmp);
+    int v = 4;
+
+    assert(mmh_insert(mmh, &v) == MMH_OK);
+    assert(mmh_peek_min(mmh) == mmh_peek_max(mmh));
+    assert(mmh_pop_max(mmh) == MMH_OK && mmh_is_empty(mmh));
+
+    int two[] = { 2, 6 };
+    assert(mmh_insert(mmh, &two[1]) == MMH_OK);
+    assert(mmh_insert(mmh, &two[0]) == MMH_OK);
+    assert(*(int *)mmh_peek_min(mmh) == 2 && *(int *)mmh_peek_max(mmh) == 6);
+    assert(mmh_pop_max(mmh) == MMH_OK);
+    assert(*(int *)mmh_peek_max(mmh) == 2);
+    assert(mmh_pop_min(mmh) == MMH_OK && mmh_is_empty(mmh));
+
+    mmh_destroy(mmh);
+    puts("✓ test_small_sizes passed");
+}
+
+static void test_drain_one_end() {
+    MinMaxHeap *mmh = mmh_create(sizeof(int), int_cmp);
+    for (int i = 0; i < 500; ++i) {
+        int v = (i * 7919) % 500;
+        assert(mmh_insert(mmh, &v) == MMH_OK);
+    }
+
+    /* reinserting from inside the buffer */
+    for (int i = 0; i < 2000; ++i) {
+        assert(mmh_insert(mmh, mmh_peek_max(mmh)) == MMH_OK);
+    }
+    for (int i = 0; i < 2000; ++i) {
+        assert(*(int *)mmh_peek_max(mmh) == 499);
+        assert(mmh_pop_max(mmh) == MMH_OK);
+    }
+
+    for (int i = 499; i >= 0; --i) {
+        assert(*(int *)mmh_peek_max(mmh) == i);
+        assert(mmh_pop_max(mmh) == MMH_OK);
+    }
+
+    mmh_destroy(mmh);
+    puts("✓ test_drain_one_end passed");
+}
+
+static void test_invalid_inputs() {
+    int v = 0;
+    assert(mmh_create(0, int_cmp) == NULL);
+    assert(mmh_create(sizeof(int), NULL) == NULL);
+    assert(mmh_insert(NULL, &v) == MMH_ERR);
+    assert(mmh_pop_min(NULL) == MMH_ERR && mmh_pop_max(NULL) == MMH_ERR);
+    assert(mmh_peek_min(NULL) == NULL && mmh_peek_max(NULL) == NULL);
+    assert(mmh_size(NULL) == 0 && mmh_is_empty(NULL));
+
+    MinMaxHeap *mmh = mmh_create(sizeof(int), int_cmp);
+    assert(mmh_insert(mmh, NULL) == MMH_ERR);
+    mmh_destroy(mmh);
+    puts("✓ test_invalid_inputs passed");
+}
+
+int main(void) {
+    test_both_ends();
+    test_small_sizes();
+    test_drain_one_end();
+    test_invalid_inputs();
+    puts("🎉 all minmax_heap unit tests passed");
+    return (0);
+}
@@ -0,0 +1,112 @@
+#include "multiqueue.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int int_cmp(const void *a, const void *b) {
+    return (*(const int *)a - *(const int *)b);
+}
+
+typedef struct Job {
+    int priority;
+    char name[28];
+} Job;
+
+static int job_cmp(const void *a, const void *b) {
+    return (((const Job *)a)->priority - ((const Job *)b)->priority);
+}
+
+static void test_push_pop_all() {
+    MultiQueue *mq = mq_create(sizeof(int), int_cmp, 8);
+    assert(mq != NULL);
+    assert(mq_is_empty(mq));
+
+    int out = -1;
+    assert(mq_pop(mq, &out) == MQ_ERR);
+
+    for (int i = 0; i < 1000; ++i) {
+        int v = (i * 7919) % 1000;
+        assert(mq_push(mq, &v) == MQ_OK);
+    }
+    assert(mq_size(mq) == 1000);
+
+    /* the order is relaxed, but every element comes out once */
+    char seen[1000] = { 0 };
+    for (int i = 0; i < 1000; ++i) {
+        assert(mq_pop(mq, &out) == MQ_OK);
+        assert(out >= 0 && out < 1000 && !seen[out]);
+        seen[out] = 1;
+    }
+
+    assert(mq_is_empty(mq));
+    assert(mq_pop(mq, &out) == MQ_ERR);
+    mq_destroy(mq);
+    puts("✓ test_push_pop_all passed");
+}
+
+static void test_two_queues_exact() {
+    /* with two queues and one thread, every pop compares both tops */
+    MultiQueue *mq = mq_create(sizeof(int), int_cmp, 2);
+
+    for (int i = 0; i < 500; ++i) {
+        int v = (i * 7919) % 500;
+        assert(mq_push(mq, &v) == MQ_OK);
+    }
+    for (int i = 0; i < 500; ++i) {
+        int out = -1;
+        assert(mq_pop(mq, &out) == MQ_OK);
+        assert(out == i);
+    }
+
+    mq_destroy(mq);
+    puts("✓ test_two_queues_exact passed");
+}
+
+static void test_wide_elements() {
+    MultiQueue *mq = mq_create(sizeof(Job), job_cmp, 2);
+
+    for (int i = 9; i >= 0; --i) {
+        Job j = { .priority = i };
+        snprintf(j.name, sizeof(j.name), "job-%d", i);
+        assert(mq_push(mq, &j) == MQ_OK);
+    }
+    for (int i = 0; i < 10; ++i) {
+        Job j;
+        char name[28];
+        assert(mq_pop(mq, &j) == MQ_OK);
+        snprintf(name, sizeof(name), "job-%d", i);
+        assert(j.priority == i && strcmp(j.name, name) == 0);
+    }
+
+    mq_destroy(mq);
+    puts("✓ test_wide_elements passed");
+}
+
+static void test_invalid_inputs() {
+    int v = 0;
+    assert(mq_create(0, int_cmp, 4) == NULL);
+    assert(mq_create(sizeof(int), NULL, 4) == NULL);
+    assert(mq_create(sizeof(int), int_cmp, 1) == NULL);
+    assert(mq_push(NULL, &v) == MQ_ERR);
+    assert(mq_pop(NULL, &v) == MQ_ERR);
+    assert(mq_size(NULL) == 0 && mq_is_empty(NULL));
+    mq_destroy(NULL);
+
+    MultiQueue *mq = mq_create(sizeof(int), int_cmp, 4);
+    assert(mq_push(mq, NULL) == MQ_ERR);
+    assert(mq_push(mq, &v) == MQ_OK);
+    assert(mq_pop(mq, NULL) == MQ_ERR);
+    assert(mq_size(mq) == 1);
+    mq_destroy(mq);
+    puts("✓ test_invalid_inputs passed");
+}
+
+int main(void) {
+    test_push_pop_all();
+    test_two_queues_exact();
+    test_wide_elements();
+    test_invalid_inputs();
+    puts("🎉 all multiqueue unit tests passed");
+    return (0);
+}
@@ -0,0 +1,172 @@
+#include "pairing_heap.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static int int_min_cmp(const void *a, const void *b) {
+    return (*(const int *)a - *(const int *)b);
+}
+
+static void drain_sorted(PairingHeap *ph, const int *expected, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        assert(*(int *)ph_peek(ph) == expected[i]);
+        assert(ph_remove_top(ph) == PH_OK);
+    }
+    assert(ph_is_empty(ph));
+}
+
+static void test_insert_and_remove() {
+    PairingHeap *ph = ph_create(sizeof(int), int_min_cmp);
+    assert(ph != NULL);
+    assert(ph_is_empty(ph));
+    assert(ph_peek(ph) == NULL);
+    assert(ph_remove_top(ph) == PH_ERR);
+
+    int vals[] = { 5, 3, 7, 1, 4, 9, 2, 8, 6, 0 };
+    for (int i = 0; i < 10; ++i) {
+        PHNode *node = ph_insert(ph, &vals[i]);
+        assert(node != NULL);
+        assert(*(int *)ph_value(node) == vals[i]);
+    }
+
+    assert(ph_size(ph) == 10);
+    int expected[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    drain_sorted(ph, expected, 10);
+
+    ph_destroy(ph);
+    puts("✓ test_insert_and_remove passed");
+}
+
+static void test_decrease_key() {
+    PairingHeap *ph = ph_create(sizeof(int), int_min_cmp);
+    PHNode *nodes[8];
+    for (int i = 0; i < 8; ++i) {
+        int v = 10 * (i + 1);
+        nodes[i] = ph_insert(ph, &v);
+    }
+
+    /* force some structure under the root first */
+    assert(ph_remove_top(ph) == PH_OK);
+
+    int v = 5;
+    assert(ph_decrease_key(ph, nodes[6], &v) == PH_OK);
+    assert(ph_peek(ph) == ph_value(nodes[6]));
+
+    /* a lower priority is refused */
+    v = 100;
+    assert(ph_decrease_key(ph, nodes[3], &v) == PH_ERR);
+    assert(*(int *)ph_value(nodes[3]) == 40);
+
+    /* in place, then with the node's own value */
+    int *elem = ph_value(nodes[7]);
+    *elem = 35;
+    assert(ph_decrease_key(ph, nodes[7], elem) == PH_OK);
+
+    int expected[] = { 5, 20, 30, 35, 40, 50, 60 };
+    drain_sorted(ph, expected, 7);
+
+    ph_destroy(ph);
+    puts("✓ test_decrease_key passed");
+}
+
+static void test_meld() {
+    PairingHeap *a = ph_create(sizeof(int), int_min_cmp);
+    PairingHeap *b = ph_create(sizeof(int), int_min_cmp);
+    PairingHeap *c = ph_create(sizeof(int), int_min_cmp);
+    PairingHeap *d = ph_create(sizeof(int), int_min_cmp);
+
+    for (int i = 0; i < 20; ++i) {
+        assert(ph_insert((i % 2) ? a : b, &i) != NULL);
+    }
+    int v = 100;
+    PHNode *moved = ph_insert(b, &v);
+
+    assert(ph_meld(a, b) == PH_OK);
+    assert(ph_size(a) == 21 && ph_is_empty(b));
+
+    /* handles follow their element */
+    v = -1;
+    assert(ph_decrease_key(a, moved, &v) == PH_OK);
+    assert(*(int *)ph_peek(a) == -1);
+
+    /* heaps that were melded before keep melding without copies */
+    v = 50;
+    assert(ph_insert(c, &v) != NULL);
+    assert(ph_insert(d, &v) != NULL);
+    assert(ph_meld(c, d) == PH_OK);
+    v = -2;
+    assert(ph_insert(c, &v) != NULL);
+    PHNode *from_d = ph_insert(d, &v);
+    assert(ph_meld(c, d) == PH_OK);
+    assert(ph_meld(a, c) == PH_OK);
+    assert(ph_size(a) == 25 && ph_is_empty(c));
+    v = -3;
+    assert(ph_decrease_key(a, from_d, &v) == PH_OK);
+
+    /* the emptied heaps are still usable */
+    assert(ph_insert(b, &v) != NULL && ph_size(b) == 1);
+
+    int expected[25];
+    expected[0] = -3;
+    expected[1] = -2;
+    expected[2] = -1;
+    for (int i = 0; i < 20; ++i) {
+        expected[i + 3] = i;
+    }
+    expected[23] = 50;
+    expected[24] = 50;
+    drain_sorted(a, expected, 25);
+
+    /* pools already shared on both sides are joined too: handles stay valid */
+    PairingHeap *e = ph_create(sizeof(int), int_min_cmp);
+    PairingHeap *f = ph_create(sizeof(int), int_min_cmp);
+    assert(ph_meld(b, e) == PH_OK);
+    assert(ph_meld(f, a) == PH_OK);
+    v = 7;
+    PHNode *from_f = ph_insert(f, &v);
+    assert(ph_meld(b, f) == PH_OK);
+    assert(ph_size(b) == 2 && ph_is_empty(f));
+    v = -4;
+    assert(ph_decrease_key(b, from_f, &v) == PH_OK);
+    assert(*(int *)ph_peek(b) == -4);
+    ph_destroy(f);
+    ph_destroy(e);
+    assert(ph_remove_top(b) == PH_OK && *(int *)ph_peek(b) == -3);
+
+    assert(ph_meld(a, a) == PH_OK);
+    ph_destroy(b);
+    ph_destroy(a);
+    ph_destroy(d);
+    ph_destroy(c);
+    puts("✓ test_meld passed");
+}
+
+static void test_invalid_inputs() {
+    int v = 1;
+    assert(ph_create(0, int_min_cmp) == NULL);
+    assert(ph_create(sizeof(int), NULL) == NULL);
+    assert(ph_insert(NULL, &v) == NULL);
+    assert(ph_remove_top(NULL) == PH_ERR);
+    assert(ph_meld(NULL, NULL) == PH_ERR);
+    assert(ph_value(NULL) == NULL);
+    assert(ph_size(NULL) == 0);
+    assert(ph_is_empty(NULL));
+
+    PairingHeap *ph = ph_create(sizeof(int), int_min_cmp);
+    PairingHeap *other = ph_create(sizeof(long long), int_min_cmp);
+    assert(ph_insert(ph, NULL) == NULL);
+    assert(ph_decrease_key(ph, NULL, &v) == PH_ERR);
+    assert(ph_meld(ph, other) == PH_ERR);
+    ph_destroy(other);
+    ph_destroy(ph);
+    puts("✓ test_invalid_inputs passed");
+}
+
+int main(void) {
+    test_insert_and_remove();
+    test_decrease_key();
+    test_meld();
+    test_invalid_inputs();
+    puts("🎉 all pairing_heap unit tests passed");
+    return (0);
+}
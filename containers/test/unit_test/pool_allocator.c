@@ -0,0 +1,220 @@
+#include "pool_allocator.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdalign.h>
+#include <stddef.h>
+#include <string.h>
+
+static void test_alloc_and_reuse(void) {
+    PoolAllocator *pool = pool_create(24);
+    assert(pool != NULL);
+    assert(pool_block_size(pool) >= 24);
+    assert(pool_block_size(pool) % alignof(max_align_t) == 0);
+
+    void *a = pool_alloc(pool);
+    void *b = pool_alloc(pool);
+    assert(a != NULL && b != NULL && a != b);
+    assert((uintptr_t)a % alignof(max_align_t) == 0);
+
+    /* blocks carved from the same slab are adjacent */
+    assert((char *)b - (char *)a == (ptrdiff_t)pool_block_size(pool));
+
+    memset(a, 0xAB, 24);
+    memset(b, 0xCD, 24);
+
+    /* a freed block is handed out again before anything new */
+    pool_free(pool, a);
+    assert(pool_alloc(pool) == a);
+
+    pool_destroy(pool);
+    puts("✓ test_alloc_and_reuse passed");
+}
+
+static void test_many_blocks(void) {
+    PoolAllocator *pool = pool_create(sizeof(int));
+    int *blocks[10000];
+
+    /* spans several (growing) slabs */
+    for (int i = 0; i < 10000; ++i) {
+        blocks[i] = pool_alloc(pool);
+        assert(blocks[i] != NULL);
+        *blocks[i] = i;
+    }
+
+    for (int i = 0; i < 10000; ++i) {
+        assert(*blocks[i] == i);
+    }
+
+    for (int i = 0; i < 10000; i += 2) {
+        pool_free(pool, blocks[i]);
+    }
+
+    for (int i = 0; i < 5000; ++i) {
+        assert(pool_alloc(pool) != NULL);
+    }
+
+    pool_destroy(pool);
+    puts("✓ test_many_blocks passed");
+}
+
+static void test_clear(void) {
+    PoolAllocator *pool = pool_create(64);
+
+    for (int i = 0; i < 1000; ++i) {
+        assert(pool_alloc(pool) != NULL);
+    }
+
+    pool_clear(pool);
+
+    /* usable again, starting over from the kept slab */
+    void *a = pool_alloc(pool);
+    void *b = pool_alloc(pool);
+    assert(a != NULL && b != NULL);
+    assert((char *)b - (char *)a == (ptrdiff_t)pool_block_size(pool));
+
+    pool_clear(pool);
+    pool_clear(pool);
+    pool_destroy(pool);
+    puts("✓ test_clear passed");
+}
+
+static void test_share_and_absorb(void) {
+    PoolAllocator *a = pool_create(sizeof(int));
+    PoolAllocator *b = pool_create(sizeof(int));
+    int *blocks[100];
+
+    for (int i = 0; i < 100; ++i) {
+        blocks[i] = pool_alloc(i % 2 ? a : b);
+        *blocks[i] = i;
+    }
+    pool_free(b, blocks[0]);
+
+    /* b's blocks now belong to a, b forwards to it */
+    assert(pool_absorb(a, b) == POOL_OK);
+    assert(pool_absorb(a, a) == POOL_ERR);
+    assert(pool_absorb(a, b) == POOL_OK);  // already joined
+    assert(pool_is_shared(a) && pool_is_shared(b));
+    pool_free(b, blocks[2]);  // through either handle
+    for (int i = 3; i < 100; ++i) {
+        assert(*blocks[i] == i);
+    }
+
+    /* recycled blocks of both free lists are handed out again, through either handle */
+    void *x = pool_alloc(b), *y = pool_alloc(a);
+    assert((x == blocks[0] && y == blocks[2]) || (x == blocks[2] && y == blocks[0]));
+    pool_destroy(b);
+    for (int i = 3; i < 100; ++i) {
+        assert(*blocks[i] == i);  // still alive in a
+    }
+
+    /* a shared pool survives until its last owner lets go, and isn't cleared */
+    assert(!pool_is_shared(a));
+    assert(pool_share(a) == a && pool_is_shared(a));
+    pool_clear(a);
+    assert(*blocks[99] == 99);
+    pool_destroy(a);
+    assert(!pool_is_shared(a) && *blocks[99] == 99);
+
+    PoolAllocator *c = pool_create(64);
+    assert(pool_absorb(a, c) == POOL_ERR);  // block sizes differ
+    pool_destroy(c);
+    pool_destroy(a);
+    assert(pool_share(NULL) == NULL);
+    puts("✓ test_share_and_absorb passed");
+}
+
+static void test_absorb_shared(void) {
+    /* two pairs of owners, each pair on one pool: a + a2, b + b2 */
+    PoolAllocator *a = pool_create(sizeof(int));
+    PoolAllocator *a2 = pool_share(a);
+    PoolAllocator *b = pool_create(sizeof(int));
+    PoolAllocator *b2 = pool_share(b);
+    int *blocks[64];
+
+    for (int i = 0; i < 64; ++i) {
+        blocks[i] = pool_alloc(i % 2 ? a : b);
+        *blocks[i] = i;
+    }
+
+    /* shared pools join too, and a chain of joins resolves to one pool */
+    PoolAllocator *c = pool_create(sizeof(int));
+    assert(pool_absorb(a, b) == POOL_OK);
+    assert(pool_absorb(c, a2) == POOL_OK);
+    assert(pool_owns(c, blocks[0]) && pool_owns(b2, blocks[1]));
+
+    /* owners leave in any order, the blocks live until the last one */
+    pool_destroy(a);
+    pool_destroy(b);
+    pool_free(b2, blocks[0]);
+    assert(pool_alloc(c) == blocks[0]);
+    pool_destroy(c);
+    pool_destroy(a2);
+    for (int i = 1; i < 64; ++i) {
+        assert(*blocks[i] == i);
+    }
+    assert(!pool_is_shared(b2) && pool_owns(b2, blocks[63]));
+
+    /* the last owner clears the whole joined memory */
+    pool_clear(b2);
+    assert(pool_alloc(b2) != NULL);
+    pool_destroy(b2);
+    puts("✓ test_absorb_shared passed");
+}
+
+static void test_reserve_and_owns(void) {
+    PoolAllocator *pool = pool_create(32);
+    PoolAllocator *other = pool_create(32);
+    size_t bs = pool_block_size(pool);
+
+    void *first = pool_alloc(pool);
+    assert(pool_owns(pool, first) && !pool_owns(other, first));
+
+    /* the next 1000 blocks come from one slab, back to back */
+    assert(pool_reserve(pool, 1000) == POOL_OK);
+    char *prev = pool_alloc(pool);
+    for (int i = 1; i < 1000; ++i) {
+        char *block = pool_alloc(pool);
+        assert(block - prev == (ptrdiff_t)bs);
+        assert(pool_owns(pool, block));
+        prev = block;
+    }
+    assert(pool_owns(pool, first));  // older slabs are still there
+
+    int local;
+    assert(!pool_owns(pool, &local) && !pool_owns(pool, NULL));
+    assert(pool_reserve(NULL, 1) == POOL_ERR);
+
+    pool_destroy(other);
+    pool_destroy(pool);
+    puts("✓ test_reserve_and_owns passed");
+}
+
+static void test_null_inputs(void) {
+    int x;
+    assert(pool_create(0) == NULL);
+    assert(pool_alloc(NULL) == NULL);
+    assert(pool_block_size(NULL) == 0);
+    pool_free(NULL, &x);
+    pool_clear(NULL);
+    pool_destroy(NULL);
+
+    PoolAllocator *pool = pool_create(1);
+    pool_free(pool, NULL);
+    pool_clear(pool);  // nothing allocated yet
+    pool_destroy(pool);
+    puts("✓ test_null_inputs passed");
+}
+
+int main(void) {
+    test_alloc_and_reuse();
+    test_many_blocks();
+    test_clear();
+    test_share_and_absorb();
+    test_absorb_shared();
+    test_reserve_and_owns();
+    test_null_inputs();
+    puts("🎉 all pool_allocator unit tests passed");
+    return EXIT_SUCCESS;
+}
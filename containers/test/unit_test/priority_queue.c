@@ -58,6 +58,41 @@ static void test_max_priority_queue() {
     puts("✓ test_max_priority_queue passed");
 }
 
+static void test_arity() {
+    PriorityQueue *pq = pq_create_arity(sizeof(int), int_min_cmp, 4);
+    assert(pq != NULL);
+    for (int i = 0; i < 100; ++i) {
+        int v = (i * 37) % 100;
+        assert(pq_push(pq, &v) == PQ_OK);
+    }
+    for (int i = 0; i < 100; ++i) {
+        assert(*(int *)pq_top(pq) == i);
+        assert(pq_pop(pq) == PQ_OK);
+    }
+    pq_destroy(pq);
+
+    assert(pq_create_arity(sizeof(int), int_min_cmp, 0) == NULL);
+    puts("✓ test_arity passed");
+}
+
+static void test_create_from() {
+    int vals[] = { 5, 3, 8, 1, 9, 2 };
+    PriorityQueue *pq = pq_create_from(vals, 6, sizeof(int), int_min_cmp);
+    assert(pq != NULL && pq_size(pq) == 6);
+
+    int expected[] = { 1, 2, 3, 5, 8, 9 };
+    for (int i = 0; i < 6; ++i) {
+        assert(*(int *)pq_top(pq) == expected[i]);
+        assert(pq_pop(pq) == PQ_OK);
+    }
+    assert(pq_is_empty(pq));
+    pq_destroy(pq);
+
+    assert(pq_create_from(NULL, 2, sizeof(int), int_min_cmp) == NULL);
+    assert(pq_create_from(vals, 6, 0, int_min_cmp) == NULL);
+    puts("✓ test_create_from passed");
+}
+
 static void test_empty_and_null_behavior() {
     assert(pq_push(NULL, NULL) == PQ_ERR);
     assert(pq_pop(NULL) == PQ_ERR);
@@ -72,6 +107,8 @@ int main(void) {
     test_min_priority_queue();
     test_max_priority_queue();
     test_empty_and_null_behavior();
+    test_create_from();
+    test_arity();
     puts("🎉 all priority_queue tests passed");
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,108 @@
+#include "radix_heap.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static void test_push_pop_order() {
+    RadixHeap *rh = rh_create(sizeof(int));
+    assert(rh != NULL);
+    assert(rh_is_empty(rh));
+    assert(rh_pop(rh, NULL, NULL) == RH_ERR);
+
+    uint64_t keys[] = { 50, 3, 1000000, 7, 3, 64, 0, 1ull << 40 };
+    for (int i = 0; i < 8; ++i) {
+        assert(rh_push(rh, keys[i], &i) == RH_OK);
+    }
+    assert(rh_size(rh) == 8);
+
+    uint64_t expected[] = { 0, 3, 3, 7, 50, 64, 1000000, 1ull << 40 };
+    for (int i = 0; i < 8; ++i) {
+        uint64_t key;
+        int payload;
+        assert(rh_top(rh, &key, NULL) == RH_OK && key == expected[i]);
+        assert(rh_pop(rh, &key, &payload) == RH_OK);
+        assert(key == expected[i] && keys[payload] == key);
+        assert(rh_last(rh) == key);
+    }
+
+    assert(rh_is_empty(rh));
+    rh_destroy(rh);
+    puts("✓ test_push_pop_order passed");
+}
+
+static void test_monotone_bound() {
+    RadixHeap *rh = rh_create(0);
+    assert(rh != NULL);
+
+    assert(rh_push(rh, 10, NULL) == RH_OK);
+    assert(rh_push(rh, 20, NULL) == RH_OK);
+    assert(rh_pop(rh, NULL, NULL) == RH_OK);
+    assert(rh_last(rh) == 10);
+
+    /* keys below the last popped one are refused, equal ones are fine */
+    assert(rh_push(rh, 9, NULL) == RH_ERR);
+    assert(rh_push(rh, 10, NULL) == RH_OK);
+
+    uint64_t key;
+    assert(rh_pop(rh, &key, NULL) == RH_OK && key == 10);
+    assert(rh_pop(rh, &key, NULL) == RH_OK && key == 20);
+
+    /* the extremes of the key range */
+    assert(rh_push(rh, UINT64_MAX, NULL) == RH_OK);
+    assert(rh_push(rh, 20, NULL) == RH_OK);
+    assert(rh_pop(rh, &key, NULL) == RH_OK && key == 20);
+    assert(rh_pop(rh, &key, NULL) == RH_OK && key == UINT64_MAX);
+
+    rh_destroy(rh);
+    puts("✓ test_monotone_bound passed");
+}
+
+static void test_wide_payload() {
+    typedef struct { char name[24]; } Event;
+    RadixHeap *rh = rh_create(sizeof(Event));
+
+    for (int i = 0; i < 100; ++i) {
+        Event e;
+        snprintf(e.name, sizeof(e.name), "event %d", 99 - i);
+        assert(rh_push(rh, (uint64_t)(99 - i), &e) == RH_OK);
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        Event e;
+        char expected[24];
+        uint64_t key;
+        assert(rh_pop(rh, &key, &e) == RH_OK && key == (uint64_t)i);
+        snprintf(expected, sizeof(expected), "event %d", i);
+        for (int c = 0; expected[c] != '\0'; ++c) {
+            assert(e.name[c] == expected[c]);
+        }
+    }
+
+    rh_destroy(rh);
+    puts("✓ test_wide_payload passed");
+}
+
+static void test_invalid_inputs() {
+    int v = 0;
+    assert(rh_push(NULL, 1, &v) == RH_ERR);
+    assert(rh_pop(NULL, NULL, NULL) == RH_ERR);
+    assert(rh_top(NULL, NULL, NULL) == RH_ERR);
+    assert(rh_last(NULL) == 0);
+    assert(rh_size(NULL) == 0);
+    assert(rh_is_empty(NULL));
+
+    RadixHeap *rh = rh_create(sizeof(int));
+    assert(rh_push(rh, 1, NULL) == RH_ERR);
+    assert(rh_top(rh, NULL, NULL) == RH_ERR);
+    rh_destroy(rh);
+    puts("✓ test_invalid_inputs passed");
+}
+
+int main(void) {
+    test_push_pop_order();
+    test_monotone_bound();
+    test_wide_payload();
+    test_invalid_inputs();
+    puts("🎉 all radix_heap unit tests passed");
+    return (0);
+}
@@ -0,0 +1,182 @@
+#include "shm_queue.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sched.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+static void make_name(char *buf, size_t size, const char *tag) {
+    snprintf(buf, size, "/adrc_shmq_%s_%d", tag, (int)getpid());
+}
+
+static void test_basic_queue_behavior(void) {
+    char name[64];
+    make_name(name, sizeof(name), "basic");
+
+    ShmQueue *q = shmq_create(name, 5, sizeof(int));
+    assert(q != NULL);
+    assert(shmq_capacity(q) == 8);  // rounded up to a power of two
+    assert(shmq_elem_size(q) == sizeof(int));
+    assert(shmq_is_empty(q));
+
+    int out;
+    assert(shmq_dequeue(q, &out) == SHMQ_ERR);
+
+    for (int i = 0; i < 8; ++i) {
+        assert(shmq_enqueue(q, &i) == SHMQ_OK);
+    }
+
+    int extra = 99;
+    assert(shmq_enqueue(q, &extra) == SHMQ_ERR);  // full
+    assert(shmq_size(q) == 8);
+
+    for (int i = 0; i < 8; ++i) {
+        assert(shmq_dequeue(q, &out) == SHMQ_OK);
+        assert(out == i);
+    }
+
+    assert(shmq_is_empty(q));
+    shmq_close(q);
+    assert(shmq_unlink(name) == SHMQ_OK);
+    puts("✓ test_basic_queue_behavior passed");
+}
+
+static void test_open_existing(void) {
+    char name[64];
+    make_name(name, sizeof(name), "open");
+
+    assert(shmq_open(name) == NULL);  // does not exist yet
+
+    ShmQueue *a = shmq_create(name, 16, sizeof(double));
+    assert(a != NULL);
+    assert(shmq_create(name, 16, sizeof(double)) == NULL);  // already exists
+
+    ShmQueue *b = shmq_open(name);
+    assert(b != NULL);
+    assert(shmq_capacity(b) == 16);
+    assert(shmq_elem_size(b) == sizeof(double));
+
+    double in = 3.5, out = 0;
+    assert(shmq_enqueue(a, &in) == SHMQ_OK);
+    assert(shmq_size(b) == 1);
+    assert(shmq_dequeue(b, &out) == SHMQ_OK);
+    assert(out == 3.5);
+
+    shmq_close(a);
+    shmq_close(b);
+    assert(shmq_unlink(name) == SHMQ_OK);
+    puts("✓ test_open_existing passed");
+}
+
+/* the header starts with the magic, then elem_size, capacity and slot_size */
+enum { HDR_ELEM_SIZE = 1, HDR_CAPACITY = 2, HDR_SLOT_SIZE = 3 };
+
+static void test_open_rejects_bad_header(void) {
+    char name[64];
+    make_name(name, sizeof(name), "badhdr");
+
+    ShmQueue *q = shmq_create(name, 16, sizeof(int));
+    assert(q != NULL);
+
+    int fd = shm_open(name, O_RDWR, 0);
+    assert(fd != -1);
+    size_t *hdr = mmap(NULL, 4 * sizeof(size_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    assert(hdr != MAP_FAILED);
+    close(fd);
+
+    size_t good[4];
+    for (int i = 0; i < 4; ++i) {
+        good[i] = hdr[i];
+    }
+
+    /* capacity not a power of two, payload larger than a slot, misaligned slots */
+    size_t fields[] = { HDR_CAPACITY, HDR_ELEM_SIZE, HDR_ELEM_SIZE, HDR_SLOT_SIZE };
+    size_t values[] = { 12, good[HDR_SLOT_SIZE], 0, good[HDR_SLOT_SIZE] + 1 };
+    for (int i = 0; i < 4; ++i) {
+        hdr[fields[i]] = values[i];
+        assert(shmq_open(name) == NULL);
+        hdr[fields[i]] = good[fields[i]];
+    }
+
+    ShmQueue *b = shmq_open(name);
+    assert(b != NULL);
+    shmq_close(b);
+
+    munmap(hdr, 4 * sizeof(size_t));
+    shmq_close(q);
+    assert(shmq_unlink(name) == SHMQ_OK);
+    puts("✓ test_open_rejects_bad_header passed");
+}
+
+static void test_cross_process(void) {
+    char name[64];
+    make_name(name, sizeof(name), "fork");
+
+    const int N = 10000;
+    ShmQueue *q = shmq_create(name, 64, sizeof(int));
+    assert(q != NULL);
+
+    pid_t pid = fork();
+    assert(pid != -1);
+
+    if (pid == 0) {
+        /* child: attach by name and produce */
+        ShmQueue *child_q = shmq_open(name);
+        if (child_q == NULL) {
+            _exit(EXIT_FAILURE);
+        }
+        for (int i = 0; i < N; ++i) {
+            while (shmq_enqueue(child_q, &i) == SHMQ_ERR) {
+                sched_yield();
+            }
+        }
+        shmq_close(child_q);
+        _exit(EXIT_SUCCESS);
+    }
+
+    /* parent: consume and check FIFO order */
+    for (int i = 0; i < N; ++i) {
+        int out;
+        while (shmq_dequeue(q, &out) == SHMQ_ERR) {
+            sched_yield();
+        }
+        assert(out == i);
+    }
+
+    int status;
+    assert(waitpid(pid, &status, 0) == pid);
+    assert(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS);
+
+    shmq_close(q);
+    assert(shmq_unlink(name) == SHMQ_OK);
+    puts("✓ test_cross_process passed");
+}
+
+static void test_null_operations(void) {
+    int val = 0;
+    assert(shmq_create(NULL, 8, sizeof(int)) == NULL);
+    assert(shmq_create("/adrc_shmq_bad", 0, sizeof(int)) == NULL);
+    assert(shmq_create("/adrc_shmq_bad", 8, 0) == NULL);
+    assert(shmq_open(NULL) == NULL);
+    assert(shmq_enqueue(NULL, &val) == SHMQ_ERR);
+    assert(shmq_dequeue(NULL, &val) == SHMQ_ERR);
+    assert(shmq_size(NULL) == 0);
+    assert(shmq_capacity(NULL) == 0);
+    assert(shmq_is_empty(NULL));
+    assert(shmq_unlink(NULL) == SHMQ_ERR);
+    shmq_close(NULL);
+    puts("✓ test_null_operations passed");
+}
+
+int main(void) {
+    test_basic_queue_behavior();
+    test_open_existing();
+    test_open_rejects_bad_header();
+    test_cross_process();
+    test_null_operations();
+    puts("🎉 all shm_queue unit tests passed");
+    return EXIT_SUCCESS;
+}
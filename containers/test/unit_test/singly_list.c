@@ -75,8 +75,193 @@ void test_clear() {
     sl_clear(list);
     assert(sl_size(list) == 0);
     assert(sl_is_empty(list));
+    assert(sl_pop_front(list) == SL_ERR);
 
+    /* reusable after clear */
+    sl_push_back(list, &x);
+    assert(*(int*)sl_front(list) == 100);
+    assert(sl_size(list) == 1);
+
+    sl_destroy(list);
+}
+
+void test_cursor_walk_and_edit() {
+    SinglyList *list = sl_create(sizeof(int));
+
+    for (int i = 0; i < 10; ++i) {
+        sl_push_back(list, &i);
+    }
+
+    /* drop odd values, duplicate multiples of 3 (one linear pass) */
+    SLCursor cur = sl_cursor_begin(list);
+    while (!sl_cursor_is_end(&cur)) {
+        int v = *(int*)sl_cursor_get(&cur);
+        if (v % 2 != 0) {
+            assert(sl_cursor_erase(&cur) == SL_OK);
+            continue ;
+        }
+        if (v % 3 == 0) {
+            assert(sl_cursor_insert_after(&cur, &v) == SL_OK);
+            assert(sl_cursor_next(&cur) == SL_OK);  // skip the copy
+        }
+        assert(sl_cursor_next(&cur) == SL_OK);
+    }
+
+    /* 0 0 2 4 6 6 8, then append through the end cursor */
+    int last = 42;
+    assert(sl_cursor_insert_before(&cur, &last) == SL_OK);
+
+    int expected[] = {0, 0, 2, 4, 6, 6, 8, 42};
+    assert(sl_size(list) == 8);
+    for (size_t i = 0; i < 8; ++i) {
+        assert(*(int*)sl_get(list, i) == expected[i]);
+    }
+    assert(*(int*)sl_back(list) == 42);
+    assert(sl_cursor_next(&cur) == SL_ERR);
+
+    /* erasing the last element moves the tail back */
+    cur = sl_cursor_begin(list);
+    for (int i = 0; i < 7; ++i) {
+        sl_cursor_next(&cur);
+    }
+    assert(sl_cursor_erase(&cur) == SL_OK);
+    assert(*(int*)sl_back(list) == 8);
+
+    /* empty list */
+    sl_clear(list);
+    cur = sl_cursor_begin(list);
+    assert(sl_cursor_is_end(&cur));
+    assert(sl_cursor_insert_before(&cur, &last) == SL_OK);
+    assert(*(int*)sl_front(list) == 42 && *(int*)sl_back(list) == 42);
+
+    sl_destroy(list);
+}
+
+typedef struct Pair {
+    int key;
+    int seq;   // insertion order, to check stability
+} Pair;
+
+static int cmp_pair(const void *a, const void *b) {
+    return (((const Pair *)a)->key - ((const Pair *)b)->key);
+}
+
+static void test_sort(void) {
+    SinglyList *list = sl_create(sizeof(Pair));
+    int keys[] = {5, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+
+    assert(sl_sort(list, cmp_pair) == SL_OK);  // empty
+    for (int i = 0; i < 11; ++i) {
+        Pair p = { keys[i], i };
+        sl_push_back(list, &p);
+    }
+
+    void *node_of_nine = sl_get(list, 5);
+    assert(sl_sort(list, cmp_pair) == SL_OK);
+    assert(sl_size(list) == 11);
+
+    for (size_t i = 1; i < 11; ++i) {
+        Pair *prev = sl_get(list, i - 1), *curr = sl_get(list, i);
+        assert(prev->key < curr->key || (prev->key == curr->key && prev->seq < curr->seq));
+    }
+
+    /* elements were relinked, not copied, and the tail was updated */
+    assert(sl_back(list) == node_of_nine);
+    Pair p = { 10, 11 };
+    sl_push_back(list, &p);
+    assert(((Pair *)sl_get(list, 11))->key == 10);
+
+    assert(sl_sort(NULL, cmp_pair) == SL_ERR);
+    assert(sl_sort(list, NULL) == SL_ERR);
+    sl_destroy(list);
+}
+
+static void test_compact(void) {
+    SinglyList *list = sl_create(sizeof(int));
+
+    /* inserting at the front scatters the nodes in reverse memory order */
+    for (int i = 99; i >= 0; --i) {
+        sl_push_front(list, &i);
+    }
+    for (int i = 0; i < 100; i += 3) {
+        sl_remove_at(list, (size_t)(i / 3 * 2));  // drops the multiples of 3, leaving holes in the pool
+    }
+    size_t n = sl_size(list);
+
+    assert(sl_compact(list) == SL_OK);
+    assert(sl_size(list) == n);
+
+    /* traversal order is now memory order, with a constant stride */
+    ptrdiff_t stride = (char *)sl_get(list, 1) - (char *)sl_get(list, 0);
+    assert(stride > 0);
+    for (size_t i = 1; i < n; ++i) {
+        assert((char *)sl_get(list, i) - (char *)sl_get(list, i - 1) == stride);
+    }
+    assert(sl_back(list) == sl_get(list, n - 1));
+
+    /* incremental: the list is edited between steps */
+    int x = 1000;
+    size_t steps = 0;
+    int status = sl_compact_step(list, 10);
+    while (status == SL_PENDING) {
+        sl_push_front(list, &x);
+        sl_remove_at(list, sl_size(list) / 2);
+        sl_remove_at(list, sl_size(list) - 1);
+        status = sl_compact_step(list, 10);
+        steps++;
+    }
+    assert(status == SL_OK && steps > 0);
+    assert(*(int *)sl_front(list) == 1000);
+    int prev = -1;
+    for (size_t i = 0; i < sl_size(list); ++i) {
+        int v = *(int *)sl_get(list, i);
+        if (v != 1000) {
+            assert(v > prev && v % 3 != 0);
+            prev = v;
+        }
+    }
+
+    sl_push_back(list, &x);
+    assert(*(int *)sl_back(list) == 1000);
+    assert(sl_compact(NULL) == SL_ERR);
+    sl_destroy(list);
+}
+
+static void test_from_and_to_array(void) {
+    int values[] = {3, 1, 4, 1, 5, 9, 2, 6};
+    SinglyList *list = sl_from_array(sizeof(int), values, 8);
+
+    assert(list != NULL && sl_size(list) == 8);
+    assert(*(int *)sl_back(list) == 6);
+
+    /* nodes come from one block, in array order */
+    ptrdiff_t stride = (char *)sl_get(list, 1) - (char *)sl_get(list, 0);
+    assert(stride > 0);
+    for (size_t i = 1; i < 8; ++i) {
+        assert((char *)sl_get(list, i) - (char *)sl_get(list, i - 1) == stride);
+    }
+
+    /* a regular list afterwards */
+    int x = 7;
+    sl_push_back(list, &x);
+    sl_pop_front(list);
+
+    int out[16] = {0};
+    assert(sl_to_array(list, out, 16) == 8);
+    int expected[] = {1, 4, 1, 5, 9, 2, 6, 7};
+    for (size_t i = 0; i < 8; ++i) {
+        assert(out[i] == expected[i]);
+    }
+    assert(sl_to_array(list, out, 3) == 3 && out[2] == 1 && out[3] == 5);
+    assert(sl_to_array(list, NULL, 3) == 0);
+    sl_destroy(list);
+
+    list = sl_from_array(sizeof(int), NULL, 0);
+    assert(list != NULL && sl_is_empty(list));
+    assert(sl_to_array(list, out, 16) == 0);
     sl_destroy(list);
+    assert(sl_from_array(sizeof(int), NULL, 4) == NULL);
+    assert(sl_from_array(0, values, 8) == NULL);
 }
 
 int main(void) {
@@ -85,6 +270,10 @@ int main(void) {
     test_insert_at();
     test_remove_at();
     test_clear();
+    test_cursor_walk_and_edit();
+    test_sort();
+    test_compact();
+    test_from_and_to_array();
     printf("✅ all singly list unit tests passed!\n");
     return (0);
 }
@@ -0,0 +1,181 @@
+#include "skip_list.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct {
+    int key;
+    int seq;
+} Pair;
+
+static int cmp_int(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return ((x > y) - (x < y));
+}
+
+static int cmp_pair_key(const void *a, const void *b) {
+    return (cmp_int(&((const Pair *)a)->key, &((const Pair *)b)->key));
+}
+
+static void check_values(SkipList *list, const int *expected, size_t n) {
+    assert(skl_size(list) == n);
+    size_t i = 0;
+    for (SKLCursor cur = skl_cursor_begin(list); !skl_cursor_is_end(&cur); skl_cursor_next(&cur)) {
+        assert(*(int *)skl_cursor_get(&cur) == expected[i]);
+        assert(*(int *)skl_select(list, i) == expected[i]);
+        i++;
+    }
+    assert(i == n);
+}
+
+static void test_create_and_destroy(void) {
+    SkipList *list = skl_create(sizeof(int), cmp_int);
+    assert(list != NULL);
+    assert(skl_is_empty(list) && skl_size(list) == 0);
+    int key = 1;
+    assert(skl_find(list, &key) == NULL && skl_lower_bound(list, &key) == NULL);
+    assert(skl_rank(list, &key) == 0 && skl_select(list, 0) == NULL);
+    assert(skl_erase(list, &key) == SKL_ERR);
+    SKLCursor cur = skl_cursor_begin(list);
+    assert(skl_cursor_is_end(&cur) && skl_cursor_next(&cur) == SKL_ERR);
+    skl_destroy(list);
+
+    assert(skl_create(0, cmp_int) == NULL);
+    assert(skl_create(sizeof(int), NULL) == NULL);
+    skl_destroy(NULL);
+    puts("✓ test_create_and_destroy passed");
+}
+
+static void test_insert_find_erase(void) {
+    SkipList *list = skl_create(sizeof(int), cmp_int);
+    int values[] = {5, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+
+    for (int i = 0; i < 10; ++i) {
+        assert(skl_insert(list, &values[i]) == SKL_OK);
+    }
+    int sorted[] = {1, 1, 2, 3, 4, 5, 5, 5, 6, 9};
+    check_values(list, sorted, 10);
+
+    int key = 5;
+    assert(*(int *)skl_find(list, &key) == 5);
+    key = 7;
+    assert(skl_find(list, &key) == NULL);
+    assert(*(int *)skl_lower_bound(list, &key) == 9);
+    key = 10;
+    assert(skl_lower_bound(list, &key) == NULL);
+
+    /* erase removes one equal element at a time */
+    key = 5;
+    assert(skl_erase(list, &key) == SKL_OK);
+    assert(skl_erase(list, &key) == SKL_OK);
+    key = 1;
+    assert(skl_erase(list, &key) == SKL_OK);
+    key = 7;
+    assert(skl_erase(list, &key) == SKL_ERR);
+    int after_erase[] = {1, 2, 3, 4, 5, 6, 9};
+    check_values(list, after_erase, 7);
+
+    skl_clear(list);
+    assert(skl_is_empty(list) && skl_select(list, 0) == NULL);
+    assert(skl_insert(list, &values[0]) == SKL_OK);
+    assert(*(int *)skl_select(list, 0) == 5);
+
+    assert(skl_insert(NULL, &values[0]) == SKL_ERR);
+    assert(skl_insert(list, NULL) == SKL_ERR);
+    skl_destroy(list);
+    puts("✓ test_insert_find_erase passed");
+}
+
+static void test_rank_and_select(void) {
+    SkipList *list = skl_create(sizeof(int), cmp_int);
+
+    /* even values 0..1998, inserted in a scrambled order */
+    for (int i = 0; i < 1000; ++i) {
+        int v = (i * 617) % 1000 * 2;
+        assert(skl_insert(list, &v) == SKL_OK);
+    }
+    for (int i = 0; i < 1000; ++i) {
+        int even = 2 * i, odd = 2 * i + 1;
+        assert(skl_rank(list, &even) == (size_t)i);
+        assert(skl_rank(list, &odd) == (size_t)i + 1);
+        assert(*(int *)skl_select(list, (size_t)i) == even);
+    }
+    assert(skl_select(list, 1000) == NULL);
+
+    /* spans stay right after erasing every other element */
+    for (int i = 0; i < 1000; i += 2) {
+        int v = 2 * i;
+        assert(skl_erase(list, &v) == SKL_OK);
+    }
+    for (int i = 0; i < 500; ++i) {
+        int v = 4 * i + 2;
+        assert(*(int *)skl_select(list, (size_t)i) == v);
+        assert(skl_rank(list, &v) == (size_t)i);
+    }
+
+    SKLCursor cur = skl_cursor_lower_bound(list, &(int){1001});
+    assert(*(int *)skl_cursor_get(&cur) == 1002);
+    skl_destroy(list);
+    puts("✓ test_rank_and_select passed");
+}
+
+static void test_equal_elements_keep_order(void) {
+    SkipList *list = skl_create(sizeof(Pair), cmp_pair_key);
+
+    for (int i = 0; i < 100; ++i) {
+        Pair p = {i % 3, i};
+        assert(skl_insert(list, &p) == SKL_OK);
+    }
+
+    int prev_key = -1, prev_seq = -1;
+    for (SKLCursor cur = skl_cursor_begin(list); !skl_cursor_is_end(&cur); skl_cursor_next(&cur)) {
+        Pair *p = skl_cursor_get(&cur);
+        assert(p->key > prev_key || (p->key == prev_key && p->seq > prev_seq));
+        prev_key = p->key;
+        prev_seq = p->seq;
+    }
+
+    /* find and erase hit the first inserted of the equal ones */
+    Pair key = {1, 0};
+    assert(((Pair *)skl_find(list, &key))->seq == 1);
+    assert(skl_erase(list, &key) == SKL_OK);
+    assert(((Pair *)skl_find(list, &key))->seq == 4);
+    skl_destroy(list);
+    puts("✓ test_equal_elements_keep_order passed");
+}
+
+static void test_concurrent_list_restrictions(void) {
+    SkipList *list = skl_create_concurrent(sizeof(int), cmp_int);
+    assert(list != NULL);
+
+    for (int i = 10; i > 0; --i) {
+        assert(skl_insert(list, &i) == SKL_OK);
+    }
+    assert(skl_size(list) == 10);
+    int key = 3;
+    assert(*(int *)skl_find(list, &key) == 3);
+
+    /* erase / rank / select need the spans, which concurrent inserts don't maintain */
+    assert(skl_erase(list, &key) == SKL_ERR);
+    assert(skl_rank(list, &key) == (size_t)-1);
+    assert(skl_select(list, 0) == NULL);
+    skl_clear(list);
+    assert(skl_size(list) == 10);
+
+    int expected = 1;
+    for (SKLCursor cur = skl_cursor_begin(list); !skl_cursor_is_end(&cur); skl_cursor_next(&cur)) {
+        assert(*(int *)skl_cursor_get(&cur) == expected++);
+    }
+    skl_destroy(list);
+    puts("✓ test_concurrent_list_restrictions passed");
+}
+
+int main(void) {
+    test_create_and_destroy();
+    test_insert_find_erase();
+    test_rank_and_select();
+    test_equal_elements_keep_order();
+    test_concurrent_list_restrictions();
+    puts("🎉 all skip_list unit tests passed");
+    return EXIT_SUCCESS;
+}
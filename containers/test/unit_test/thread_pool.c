@@ -0,0 +1,151 @@
+#include "thread_pool.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct FibArgs {
+    ThreadPool *pool;
+    int n;
+    long result;
+} FibArgs;
+
+/* fork-join fibonacci: spawn one branch, compute the other, then sync */
+static void fib_task(void *arg) {
+    FibArgs *a = arg;
+
+    if (a->n < 2) {
+        a->result = a->n;
+        return ;
+    }
+
+    FibArgs left = { a->pool, a->n - 1, 0 };
+    FibArgs right = { a->pool, a->n - 2, 0 };
+
+    TPTask *t = tp_spawn(a->pool, fib_task, &left);
+    assert(t != NULL);
+    fib_task(&right);
+    assert(tp_sync(a->pool, t) == TP_OK);
+
+    a->result = left.result + right.result;
+}
+
+static void test_fork_join(void) {
+    ThreadPool *pool = tp_create(4);
+    assert(pool != NULL);
+    assert(tp_num_workers(pool) == 4);
+
+    FibArgs args = { pool, 20, 0 };
+    fib_task(&args);
+    assert(args.result == 6765);
+
+    tp_destroy(pool);
+    puts("✓ test_fork_join passed");
+}
+
+static void inc_task(void *arg) {
+    (*(int *)arg)++;
+}
+
+static void test_many_siblings(void) {
+    ThreadPool *pool = tp_create(3);
+    int counters[500] = { 0 };
+    TPTask *tasks[500];
+
+    for (int i = 0; i < 500; ++i) {
+        tasks[i] = tp_spawn(pool, inc_task, &counters[i]);
+        assert(tasks[i] != NULL);
+    }
+
+    for (int i = 0; i < 500; ++i) {
+        assert(tp_sync(pool, tasks[i]) == TP_OK);
+        assert(counters[i] == 1);
+    }
+
+    tp_destroy(pool);
+    puts("✓ test_many_siblings passed");
+}
+
+static void test_single_worker(void) {
+    ThreadPool *pool = tp_create(1);
+    int counter = 0;
+
+    TPTask *t = tp_spawn(pool, inc_task, &counter);
+    assert(t != NULL);
+    assert(tp_sync(pool, t) == TP_OK);  // runs inline on the caller
+    assert(counter == 1);
+
+    tp_destroy(pool);
+    puts("✓ test_single_worker passed");
+}
+
+static void test_null_inputs(void) {
+    int counter = 0;
+    assert(tp_create(0) == NULL);
+    assert(tp_spawn(NULL, inc_task, &counter) == NULL);
+    assert(tp_sync(NULL, NULL) == TP_ERR);
+    assert(tp_num_workers(NULL) == 0);
+    tp_destroy(NULL);
+
+    ThreadPool *pool = tp_create(2);
+    assert(tp_spawn(pool, NULL, &counter) == NULL);
+    assert(tp_sync(pool, NULL) == TP_ERR);
+    tp_destroy(pool);
+    puts("✓ test_null_inputs passed");
+}
+
+/* creates a second pool from inside a task of the first one */
+static void nested_pool_task(void *arg) {
+    ThreadPool *inner = tp_create(2);
+    assert(inner != NULL);
+
+    FibArgs args = { inner, 12, 0 };
+    fib_task(&args);
+    tp_destroy(inner);
+
+    *(long *)arg = args.result;
+}
+
+static void test_several_pools(void) {
+    ThreadPool *a = tp_create(3);
+    ThreadPool *b = tp_create(2);
+    assert(a != NULL && b != NULL);
+
+    /* both pools stay usable from the thread that created them */
+    FibArgs args_a = { a, 15, 0 };
+    FibArgs args_b = { b, 16, 0 };
+    fib_task(&args_a);
+    fib_task(&args_b);
+    assert(args_a.result == 610 && args_b.result == 987);
+
+    /* destroying one doesn't detach the thread from the other */
+    tp_destroy(b);
+    int counter = 0;
+    TPTask *t = tp_spawn(a, inc_task, &counter);
+    assert(t != NULL);
+    assert(tp_sync(a, t) == TP_OK && counter == 1);
+
+    /* a task (possibly on a worker thread of `a`) creates its own pool */
+    long results[8] = { 0 };
+    TPTask *tasks[8];
+    for (int i = 0; i < 8; ++i) {
+        tasks[i] = tp_spawn(a, nested_pool_task, &results[i]);
+        assert(tasks[i] != NULL);
+    }
+    for (int i = 0; i < 8; ++i) {
+        assert(tp_sync(a, tasks[i]) == TP_OK);
+        assert(results[i] == 144);
+    }
+
+    tp_destroy(a);
+    puts("✓ test_several_pools passed");
+}
+
+int main(void) {
+    test_fork_join();
+    test_many_siblings();
+    test_single_worker();
+    test_null_inputs();
+    test_several_pools();
+    puts("🎉 all thread_pool unit tests passed");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,196 @@
+#include "timing_wheel.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* records the payloads fired, in order */
+typedef struct {
+    int fired[64];
+    size_t count;
+} Log;
+
+static void record(void *elem, void *arg) {
+    Log *log = arg;
+    log->fired[log->count++] = *(int *)elem;
+}
+
+static void test_fire_in_order() {
+    TimingWheel *tw = tw_create(sizeof(int), 0, 1, 4);
+    assert(tw != NULL);
+    assert(tw_is_empty(tw));
+
+    /* one timer per level, and one past the 256^2 boundary */
+    uint64_t times[] = { 70000, 5, 300, 255, 256, 65536, 20000000 };
+    for (int i = 0; i < 7; ++i) {
+        assert(tw_schedule(tw, times[i], &i) != NULL);
+    }
+    assert(tw_size(tw) == 7);
+
+    Log log = { .count = 0 };
+    assert(tw_advance(tw, 4, record, &log) == 0);
+    assert(tw_advance(tw, 5, record, &log) == 1 && log.fired[0] == 1);
+    assert(tw_advance(tw, 256, record, &log) == 2);
+    assert(log.fired[1] == 3 && log.fired[2] == 4);
+    assert(tw_advance(tw, 65535, record, &log) == 1 && log.fired[3] == 2);
+    assert(tw_advance(tw, 70000, record, &log) == 2);
+    assert(log.fired[4] == 5 && log.fired[5] == 0);
+    assert(tw_advance(tw, 19999999, record, &log) == 0);
+    assert(tw_advance(tw, UINT64_MAX / 2, record, &log) == 1 && log.fired[6] == 6);
+    assert(tw_is_empty(tw));
+
+    tw_destroy(tw);
+    puts("✓ test_fire_in_order passed");
+}
+
+static void test_resolution_and_start() {
+    /* 10 units per tick, starting at 1000 */
+    TimingWheel *tw = tw_create(sizeof(int), 1000, 10, 2);
+    int v = 1;
+
+    /* never early: 1015 rounds up to the tick ending at 1020 */
+    assert(tw_schedule(tw, 1015, &v) != NULL);
+    Log log = { .count = 0 };
+    assert(tw_advance(tw, 1019, record, &log) == 0);
+    assert(tw_advance(tw, 1020, record, &log) == 1);
+
+    /* a time already reached fires at the next tick */
+    v = 2;
+    assert(tw_schedule(tw, 500, &v) != NULL);
+    assert(tw_advance(tw, 1029, record, &log) == 0);
+    assert(tw_advance(tw, 1030, record, &log) == 1 && log.fired[1] == 2);
+
+    /* going back in time does nothing */
+    assert(tw_advance(tw, 10, record, &log) == 0);
+
+    tw_destroy(tw);
+    puts("✓ test_resolution_and_start passed");
+}
+
+static void test_last_tick() {
+    TimingWheel *tw = tw_create(sizeof(int), 0, 1, 2);
+    int v = 1;
+
+    /* the tick count saturates at UINT64_MAX */
+    assert(tw_advance(tw, UINT64_MAX, NULL, NULL) == 0);
+    assert(tw_advance(tw, UINT64_MAX, NULL, NULL) == 0);
+
+    Log log = { .count = 0 };
+    assert(tw_schedule(tw, 5, &v) != NULL);
+    assert(tw_advance(tw, UINT64_MAX, record, &log) == 1 && log.fired[0] == 1);
+    tw_destroy(tw);
+
+    /* a timer on the last tick, reached across the overflow list */
+    tw = tw_create(sizeof(int), 0, 1, 2);
+    v = 2;
+    assert(tw_schedule(tw, UINT64_MAX, &v) != NULL);
+    assert(tw_advance(tw, UINT64_MAX - 1, record, &log) == 0);
+    assert(tw_advance(tw, UINT64_MAX, record, &log) == 1 && log.fired[1] == 2);
+    assert(tw_is_empty(tw));
+    tw_destroy(tw);
+
+    puts("✓ test_last_tick passed");
+}
+
+static void test_cancel() {
+    TimingWheel *tw = tw_create(sizeof(int), 0, 1, 2);
+    TWTimer *timers[10];
+    for (int i = 0; i < 10; ++i) {
+        timers[i] = tw_schedule(tw, (uint64_t)(i % 2 ? 100 : 100000), &i);
+        assert(*(int *)tw_value(timers[i]) == i);
+    }
+
+    /* cancel everything but 3 and 4, in the wheels and in the overflow list */
+    for (int i = 0; i < 10; ++i) {
+        if (i != 3 && i != 4) {
+            assert(tw_cancel(tw, timers[i]) == TW_OK);
+        }
+    }
+    assert(tw_size(tw) == 2);
+
+    Log log = { .count = 0 };
+    assert(tw_advance(tw, 200000, record, &log) == 2);
+    assert(log.fired[0] == 3 && log.fired[1] == 4);
+
+    tw_destroy(tw);
+    puts("✓ test_cancel passed");
+}
+
+/* the callback re-arms its timer 10 ticks later, up to 5 times, and cancels the other one */
+typedef struct {
+    TimingWheel *tw;
+    TWTimer *victim;
+    uint64_t now;
+    int rearmed;
+} Ctx;
+
+static void rearm(void *elem, void *arg) {
+    Ctx *ctx = arg;
+
+    if (*(int *)elem == 1 && ctx->victim != NULL) {
+        assert(tw_cancel(ctx->tw, ctx->victim) == TW_OK);
+        ctx->victim = NULL;
+    }
+
+    if (ctx->rearmed < 5) {
+        ctx->rearmed++;
+        assert(tw_schedule(ctx->tw, ctx->now + 10, elem) != NULL);
+    }
+}
+
+static void test_callbacks() {
+    TimingWheel *tw = tw_create(sizeof(int), 0, 1, 1);
+    Ctx ctx = { tw, NULL, 0, 0 };
+    int one = 1;
+    int two = 2;
+
+    assert(tw_schedule(tw, 0, &one) != NULL);
+    ctx.victim = tw_schedule(tw, 0, &two);   // fired in the same batch, cancelled first
+
+    size_t fired = 0;
+    for (ctx.now = 0; ctx.now < 1000; ++ctx.now) {
+        fired += tw_advance(tw, ctx.now, rearm, &ctx);
+    }
+
+    assert(fired == 6 && ctx.rearmed == 5);
+    assert(tw_is_empty(tw));
+
+    tw_destroy(tw);
+    puts("✓ test_callbacks passed");
+}
+
+static void test_invalid_inputs() {
+    int v = 0;
+    assert(tw_create(sizeof(int), 0, 0, 2) == NULL);
+    assert(tw_create(sizeof(int), 0, 1, 0) == NULL);
+    assert(tw_create(sizeof(int), 0, 1, 9) == NULL);
+    assert(tw_schedule(NULL, 1, &v) == NULL);
+    assert(tw_cancel(NULL, NULL) == TW_ERR);
+    assert(tw_advance(NULL, 1, NULL, NULL) == 0);
+    assert(tw_value(NULL) == NULL);
+    assert(tw_size(NULL) == 0);
+    assert(tw_is_empty(NULL));
+
+    TimingWheel *tw = tw_create(sizeof(int), 0, 1, 8);
+    assert(tw_schedule(tw, 1, NULL) == NULL);
+    assert(tw_cancel(tw, NULL) == TW_ERR);
+
+    /* no payload, and every bit of the tick used */
+    TimingWheel *bare = tw_create(0, 0, 1, 8);
+    assert(tw_schedule(bare, UINT64_MAX - 1, NULL) != NULL);
+    assert(tw_advance(bare, UINT64_MAX - 2, NULL, NULL) == 0);
+    assert(tw_advance(bare, UINT64_MAX - 1, NULL, NULL) == 1);
+    tw_destroy(bare);
+    tw_destroy(tw);
+    puts("✓ test_invalid_inputs passed");
+}
+
+int main(void) {
+    test_fire_in_order();
+    test_resolution_and_start();
+    test_last_tick();
+    test_cancel();
+    test_callbacks();
+    test_invalid_inputs();
+    puts("🎉 all timing_wheel unit tests passed");
+    return (0);
+}
@@ -0,0 +1,112 @@
+#include "topk.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static size_t comparisons = 0;
+
+static int int_cmp(const void *a, const void *b) {
+    comparisons++;
+    return (*(const int *)a - *(const int *)b);
+}
+
+static int int_rev_cmp(const void *a, const void *b) {
+    return (*(const int *)b - *(const int *)a);
+}
+
+static void test_keeps_largest() {
+    TopK *topk = topk_create(4, sizeof(int), int_cmp);
+    assert(topk != NULL);
+    assert(topk_capacity(topk) == 4 && topk_size(topk) == 0);
+    assert(topk_threshold(topk) == NULL);
+
+    int vals[] = { 5, 1, 9, 3, 7, 2, 8, 6, 4 };
+    for (int i = 0; i < 9; ++i) {
+        assert(topk_offer(topk, &vals[i]) != TOPK_ERR);
+    }
+
+    assert(topk_size(topk) == 4);
+    assert(*(const int *)topk_threshold(topk) == 6);
+
+    int out[4];
+    int expected[] = { 9, 8, 7, 6 };
+    assert(topk_sorted(topk, out) == 4);
+    for (int i = 0; i < 4; ++i) {
+        assert(out[i] == expected[i]);
+    }
+
+    /* sorting left the container as it was */
+    assert(topk_size(topk) == 4 && *(const int *)topk_threshold(topk) == 6);
+
+    topk_destroy(topk);
+    puts("✓ test_keeps_largest passed");
+}
+
+static void test_reject_costs_one_compare() {
+    TopK *topk = topk_create(8, sizeof(int), int_cmp);
+    for (int i = 100; i < 108; ++i) {
+        assert(topk_offer(topk, &i) == TOPK_OK);
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        comparisons = 0;
+        assert(topk_offer(topk, &i) == TOPK_REJECTED);
+        assert(comparisons == 1);
+    }
+
+    /* ties with the threshold are rejected too */
+    int tie = 100;
+    assert(topk_offer(topk, &tie) == TOPK_REJECTED);
+
+    int better = 1000;
+    assert(topk_offer(topk, &better) == TOPK_OK);
+    assert(*(const int *)topk_threshold(topk) == 101);
+
+    topk_destroy(topk);
+    puts("✓ test_reject_costs_one_compare passed");
+}
+
+static void test_smallest_and_partial() {
+    TopK *topk = topk_create(5, sizeof(int), int_rev_cmp);
+    int vals[] = { 4, 2, 9 };
+    for (int i = 0; i < 3; ++i) {
+        assert(topk_offer(topk, &vals[i]) == TOPK_OK);
+    }
+
+    int out[5];
+    assert(topk_sorted(topk, out) == 3);
+    assert(out[0] == 2 && out[1] == 4 && out[2] == 9);
+
+    topk_clear(topk);
+    assert(topk_size(topk) == 0 && topk_sorted(topk, out) == 0);
+
+    topk_destroy(topk);
+    puts("✓ test_smallest_and_partial passed");
+}
+
+static void test_invalid_inputs() {
+    int v = 0;
+    assert(topk_create(0, sizeof(int), int_cmp) == NULL);
+    assert(topk_create(4, 0, int_cmp) == NULL);
+    assert(topk_create(4, sizeof(int), NULL) == NULL);
+    assert(topk_offer(NULL, &v) == TOPK_ERR);
+    assert(topk_sorted(NULL, &v) == 0);
+    assert(topk_threshold(NULL) == NULL);
+    assert(topk_size(NULL) == 0 && topk_capacity(NULL) == 0);
+
+    TopK *topk = topk_create(4, sizeof(int), int_cmp);
+    assert(topk_offer(topk, NULL) == TOPK_ERR);
+    assert(topk_offer(topk, &v) == TOPK_OK);
+    assert(topk_sorted(topk, NULL) == 0);
+    topk_destroy(topk);
+    puts("✓ test_invalid_inputs passed");
+}
+
+int main(void) {
+    test_keeps_largest();
+    test_reject_costs_one_compare();
+    test_smallest_and_partial();
+    test_invalid_inputs();
+    puts("🎉 all topk unit tests passed");
+    return (0);
+}
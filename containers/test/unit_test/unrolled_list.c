@@ -0,0 +1,151 @@
+#include "unrolled_list.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* 64-byte records give small nodes, so splits and merges happen early */
+typedef struct Record {
+    int key;
+    char pad[60];
+} Record;
+
+static void check_keys(UnrolledList *list, const int *expected, size_t n) {
+    assert(ul_size(list) == n);
+    for (size_t i = 0; i < n; ++i) {
+        assert(((Record *)ul_get(list, i))->key == expected[i]);
+    }
+}
+
+static void test_create_and_destroy(void) {
+    UnrolledList *list = ul_create(sizeof(int));
+    assert(list != NULL);
+    assert(ul_is_empty(list) && ul_size(list) == 0);
+    assert(ul_node_capacity(list) >= 8);
+    assert(ul_front(list) == NULL && ul_back(list) == NULL);
+    assert(ul_get(list, 0) == NULL);
+    assert(ul_pop_front(list) == UL_ERR && ul_pop_back(list) == UL_ERR);
+    ul_destroy(list);
+
+    assert(ul_create(0) == NULL);
+    ul_destroy(NULL);
+    puts("✓ test_create_and_destroy passed");
+}
+
+static void test_push_and_pop(void) {
+    UnrolledList *list = ul_create(sizeof(int));
+
+    /* spans several nodes from both ends */
+    for (int i = 0; i < 1000; ++i) {
+        assert(ul_push_back(list, &i) == UL_OK);
+        int neg = -1 - i;
+        assert(ul_push_front(list, &neg) == UL_OK);
+    }
+    assert(ul_size(list) == 2000);
+    assert(*(int *)ul_front(list) == -1000 && *(int *)ul_back(list) == 999);
+
+    for (size_t i = 0; i < 2000; ++i) {
+        assert(*(int *)ul_get(list, i) == (int)i - 1000);
+    }
+
+    for (int i = 0; i < 500; ++i) {
+        assert(ul_pop_front(list) == UL_OK);
+        assert(ul_pop_back(list) == UL_OK);
+    }
+    assert(ul_size(list) == 1000);
+    assert(*(int *)ul_front(list) == -500 && *(int *)ul_back(list) == 499);
+
+    while (!ul_is_empty(list)) {
+        assert(ul_pop_back(list) == UL_OK);
+    }
+    assert(ul_front(list) == NULL);
+
+    ul_destroy(list);
+    puts("✓ test_push_and_pop passed");
+}
+
+static void test_split_and_merge(void) {
+    UnrolledList *list = ul_create(sizeof(Record));
+    size_t cap = ul_node_capacity(list);
+    int expected[64];
+    size_t n = 0;
+
+    assert(cap == 8);
+
+    /* two full nodes */
+    for (int i = 0; i < 16; ++i) {
+        Record r = { i * 10, { 0 } };
+        ul_push_back(list, &r);
+        expected[n++] = i * 10;
+    }
+
+    /* inserting into a full node splits it */
+    Record r = { 35, { 0 } };
+    assert(ul_insert_at(list, 4, &r) == UL_OK);
+    for (size_t i = n; i > 4; --i) {
+        expected[i] = expected[i - 1];
+    }
+    expected[4] = 35;
+    n++;
+    check_keys(list, expected, n);
+
+    r.key = 155;
+    assert(ul_insert_at(list, 16, &r) == UL_OK);
+    for (size_t i = n; i > 16; --i) {
+        expected[i] = expected[i - 1];
+    }
+    expected[16] = 155;
+    n++;
+    check_keys(list, expected, n);
+
+    /* removals shrink nodes until neighbours merge back */
+    while (n > 3) {
+        size_t index = n / 2;
+        assert(ul_remove_at(list, index) == UL_OK);
+        for (size_t i = index; i + 1 < n; ++i) {
+            expected[i] = expected[i + 1];
+        }
+        n--;
+        check_keys(list, expected, n);
+    }
+
+    assert(ul_insert_at(list, 4, &r) == UL_ERR);  // out of range
+    assert(ul_remove_at(list, 3) == UL_ERR);
+    assert(ul_insert_at(list, 3, &r) == UL_OK);   // same as push_back
+    assert(((Record *)ul_back(list))->key == 155);
+
+    ul_destroy(list);
+    puts("✓ test_split_and_merge passed");
+}
+
+static void test_clear(void) {
+    UnrolledList *list = ul_create(sizeof(int));
+
+    for (int i = 0; i < 300; ++i) {
+        ul_push_back(list, &i);
+    }
+    assert(*(int *)ul_get(list, 150) == 150);  // leaves the finger mid-list
+
+    ul_clear(list);
+    assert(ul_is_empty(list));
+    assert(ul_get(list, 0) == NULL);
+
+    int x = 7;
+    ul_push_front(list, &x);
+    assert(*(int *)ul_get(list, 0) == 7);
+
+    ul_clear(NULL);
+    assert(ul_size(NULL) == 0 && ul_is_empty(NULL));
+    assert(ul_push_back(NULL, &x) == UL_ERR && ul_push_back(list, NULL) == UL_ERR);
+
+    ul_destroy(list);
+    puts("✓ test_clear passed");
+}
+
+int main(void) {
+    test_create_and_destroy();
+    test_push_and_pop();
+    test_split_and_merge();
+    test_clear();
+    puts("🎉 all unrolled_list unit tests passed");
+    return EXIT_SUCCESS;
+}
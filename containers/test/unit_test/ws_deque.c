@@ -0,0 +1,74 @@
+#include "ws_deque.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static void test_owner_lifo(void) {
+    WSDeque *dq = wsd_create(4);
+    assert(dq != NULL);
+    assert(wsd_size(dq) == 0);
+    assert(wsd_pop(dq) == NULL);
+
+    int vals[100];
+    for (int i = 0; i < 100; ++i) {
+        vals[i] = i;
+        assert(wsd_push(dq, &vals[i]) == WSD_OK);  // grows past the initial capacity
+    }
+
+    assert(wsd_size(dq) == 100);
+
+    for (int i = 99; i >= 0; --i) {
+        int *item = wsd_pop(dq);
+        assert(item != NULL && *item == i);
+    }
+
+    assert(wsd_pop(dq) == NULL);
+    wsd_destroy(dq);
+    puts("✓ test_owner_lifo passed");
+}
+
+static void test_steal_fifo(void) {
+    WSDeque *dq = wsd_create(16);
+    int vals[10];
+
+    for (int i = 0; i < 10; ++i) {
+        vals[i] = i;
+        assert(wsd_push(dq, &vals[i]) == WSD_OK);
+    }
+
+    /* thieves take the oldest items, the owner the newest */
+    assert(*(int *)wsd_steal(dq) == 0);
+    assert(*(int *)wsd_steal(dq) == 1);
+    assert(*(int *)wsd_pop(dq) == 9);
+    assert(wsd_size(dq) == 7);
+
+    while (wsd_steal(dq) != NULL) {
+        ;
+    }
+
+    assert(wsd_size(dq) == 0);
+    assert(wsd_pop(dq) == NULL);
+    wsd_destroy(dq);
+    puts("✓ test_steal_fifo passed");
+}
+
+static void test_null_inputs(void) {
+    WSDeque *dq = wsd_create(0);
+    assert(dq != NULL);
+    assert(wsd_push(dq, NULL) == WSD_ERR);
+    assert(wsd_push(NULL, dq) == WSD_ERR);
+    assert(wsd_pop(NULL) == NULL);
+    assert(wsd_steal(NULL) == NULL);
+    assert(wsd_size(NULL) == 0);
+    wsd_destroy(NULL);
+    wsd_destroy(dq);
+    puts("✓ test_null_inputs passed");
+}
+
+int main(void) {
+    test_owner_lifo();
+    test_steal_fifo();
+    test_null_inputs();
+    puts("🎉 all ws_deque unit tests passed");
+    return EXIT_SUCCESS;
+}